@@ -11,9 +11,23 @@
 
 #include <string.h>
 
+#include "cJSON_Binding.h"
+#include "cJSON_Columns.h"
 #include "cJSON_Constants.h"
+#include "cJSON_Doc.h"
+#include "cJSON_DocCache.h"
 #include "cJSON_GenericStack.h"
+#include "cJSON_Hash.h"
+#include "cJSON_Iter.h"
+#include "cJSON_Minify.h"
+#include "cJSON_ParseContext.h"
+#include "cJSON_Patch.h"
+#include "cJSON_SourceSpan.h"
+#include "cJSON_Stats.h"
+#include "cJSON_Stream.h"
 #include "cJSON_Types.h"
+#include "cJSON_Validator.h"
+#include "cJSON_Writer.h"
 
 //   ---   Function Prototypes   ---
 
@@ -21,23 +35,103 @@
 #pragma region Structural Functions
 
 /**
- * @brief   Function used to try and append a generic object to a dictionary in a generic object.
+ * @brief   Function used to try and append a generic object to a dictionary in a generic object. Only heap allocated containers can be modified.
  * 
  * @param   GObjPtr 
  * @param   key Key string.
  * @param   valObj Value cJSON generic object.
- * @return  cJSON_Result_t Returns the result of this operation. Can be one of the following: cJSON_Ok, cJSON_Datatype_Error
+ * @return  cJSON_Result_t Returns the result of this operation. Can be one of the following: cJSON_Ok, cJSON_Datatype_Error (wrong type or arena allocated container)
  */
 cJSON_Result_t cJSON_tryAppendToDict(cJSON_Generic_t *GObjPtr, const cJSON_Key_t key, cJSON_Generic_t valObj);
 /**
- * @brief   Function used to try and append a generic object to a list in a generic object.
+ * @brief   Function used to try and append a generic object to a list in a generic object. Only heap allocated containers can be modified.
  * 
  * @param   GObjPtr 
  * @param   obj 
- * @return  cJSON_Result_t Returns the result of this operation. Can be one of the following: cJSON_Ok, cJSON_Datatype_Error 
+ * @return  cJSON_Result_t Returns the result of this operation. Can be one of the following: cJSON_Ok, cJSON_Datatype_Error (wrong type or arena allocated container) 
  */
 cJSON_Result_t cJSON_tryAppendToList(cJSON_Generic_t *GObjPtr, cJSON_Generic_t obj);
 
+/**
+ * @brief   Function used to try and insert a generic object into a dictionary in a generic object at a given position. Only heap allocated containers can be modified.
+ * 
+ * @param   GObjPtr 
+ * @param   index Insert position (0 to length).
+ * @param   key Key string.
+ * @param   valObj Value cJSON generic object.
+ * @return  cJSON_Result_t Returns the result of this operation. Can be one of the following: cJSON_Ok, cJSON_Datatype_Error (wrong type or arena allocated container), cJSON_NotFound_Error (index out of range)
+ */
+cJSON_Result_t cJSON_tryInsertIntoDict(cJSON_Generic_t *GObjPtr, cJSON_object_size_size_t index, const cJSON_Key_t key, cJSON_Generic_t valObj);
+/**
+ * @brief   Function used to try and insert a generic object into a list in a generic object at a given position. Only heap allocated containers can be modified.
+ * 
+ * @param   GObjPtr 
+ * @param   index Insert position (0 to length).
+ * @param   obj 
+ * @return  cJSON_Result_t Returns the result of this operation. Can be one of the following: cJSON_Ok, cJSON_Datatype_Error (wrong type or arena allocated container), cJSON_NotFound_Error (index out of range)
+ */
+cJSON_Result_t cJSON_tryInsertIntoList(cJSON_Generic_t *GObjPtr, cJSON_object_size_size_t index, cJSON_Generic_t obj);
+
+/**
+ * @brief   Function used to try and replace the value stored at a key of a dictionary in a generic object. The previous value is deleted. Only heap allocated containers can be modified.
+ * 
+ * @param   GObjPtr 
+ * @param   key Key string.
+ * @param   valObj New value cJSON generic object.
+ * @return  cJSON_Result_t Returns the result of this operation. Can be one of the following: cJSON_Ok, cJSON_Datatype_Error (wrong type or arena allocated container), cJSON_NotFound_Error
+ */
+cJSON_Result_t cJSON_tryReplaceInDict(cJSON_Generic_t *GObjPtr, const cJSON_Key_t key, cJSON_Generic_t valObj);
+/**
+ * @brief   Function used to try and replace the item at an index of a list in a generic object. The previous item is deleted. Only heap allocated containers can be modified.
+ * 
+ * @param   GObjPtr 
+ * @param   index Index of the item.
+ * @param   obj New cJSON generic object.
+ * @return  cJSON_Result_t Returns the result of this operation. Can be one of the following: cJSON_Ok, cJSON_Datatype_Error (wrong type or arena allocated container), cJSON_NotFound_Error
+ */
+cJSON_Result_t cJSON_tryReplaceInList(cJSON_Generic_t *GObjPtr, cJSON_object_size_size_t index, cJSON_Generic_t obj);
+
+/**
+ * @brief   Function used to try and remove an entry by key from a dictionary in a generic object. The removed value is deleted, the order of the remaining entries is kept. Only heap allocated containers can be modified.
+ * 
+ * @param   GObjPtr 
+ * @param   key Key string.
+ * @return  cJSON_Result_t Returns the result of this operation. Can be one of the following: cJSON_Ok, cJSON_Datatype_Error (wrong type or arena allocated container), cJSON_NotFound_Error
+ */
+cJSON_Result_t cJSON_tryRemoveFromDict(cJSON_Generic_t *GObjPtr, const cJSON_Key_t key);
+/**
+ * @brief   Function used to try and remove an entry by index from a dictionary in a generic object. The removed value is deleted, the order of the remaining entries is kept. Only heap allocated containers can be modified.
+ * 
+ * @param   GObjPtr 
+ * @param   index Index of the entry.
+ * @return  cJSON_Result_t Returns the result of this operation. Can be one of the following: cJSON_Ok, cJSON_Datatype_Error (wrong type or arena allocated container), cJSON_NotFound_Error
+ */
+cJSON_Result_t cJSON_tryRemoveFromDictAt(cJSON_Generic_t *GObjPtr, cJSON_object_size_size_t index);
+/**
+ * @brief   Function used to try and remove an item by index from a list in a generic object. The removed item is deleted, the order of the remaining items is kept. Only heap allocated containers can be modified.
+ * 
+ * @param   GObjPtr 
+ * @param   index Index of the item.
+ * @return  cJSON_Result_t Returns the result of this operation. Can be one of the following: cJSON_Ok, cJSON_Datatype_Error (wrong type or arena allocated container), cJSON_NotFound_Error
+ */
+cJSON_Result_t cJSON_tryRemoveFromList(cJSON_Generic_t *GObjPtr, cJSON_object_size_size_t index);
+/**
+ * @brief   Function used to try and remove an entry by key from a dictionary in a generic object in O(1) by moving the last entry into its place. The removed value is deleted. Only heap allocated containers can be modified.
+ * 
+ * @param   GObjPtr 
+ * @param   key Key string.
+ * @return  cJSON_Result_t Returns the result of this operation. Can be one of the following: cJSON_Ok, cJSON_Datatype_Error (wrong type or arena allocated container), cJSON_NotFound_Error
+ */
+cJSON_Result_t cJSON_trySwapRemoveFromDict(cJSON_Generic_t *GObjPtr, const cJSON_Key_t key);
+/**
+ * @brief   Function used to try and remove an item by index from a list in a generic object in O(1) by moving the last item into its place. The removed item is deleted. Only heap allocated containers can be modified.
+ * 
+ * @param   GObjPtr 
+ * @param   index Index of the item.
+ * @return  cJSON_Result_t Returns the result of this operation. Can be one of the following: cJSON_Ok, cJSON_Datatype_Error (wrong type or arena allocated container), cJSON_NotFound_Error
+ */
+cJSON_Result_t cJSON_trySwapRemoveFromList(cJSON_Generic_t *GObjPtr, cJSON_object_size_size_t index);
+
 /**
  * @brief   Function that deletes a generic object together with all of its children (recursive).
  * @param   GObj cJSON_Generic_t object that is to be deleted.
@@ -45,6 +139,24 @@ cJSON_Result_t cJSON_tryAppendToList(cJSON_Generic_t *GObjPtr, cJSON_Generic_t o
  */
 cJSON_Result_t cJSON_delGenObj(cJSON_Generic_t GObj);
 
+/**
+ * @brief   Function that creates an independent deep copy of a generic object. A sizing pass determines the clone's total size first, so an arena backed clone is placed in a single contiguous block. Container arrays are copied in bulk.
+ * 
+ * @param   src cJSON_Generic_t object that is to be copied.
+ * @param   dst Pointer to a cJSON_Generic_t variable the clone is stored in.
+ * @param   opts Clone options. May be NULL (heap allocated clone).
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_NotAllocated_Error if the memory for the clone could not be allocated.
+ */
+cJSON_Result_t cJSON_clone(cJSON_Generic_t src, cJSON_Generic_t *dst, const cJSON_CloneOptions_t *opts);
+
+/**
+ * @brief   Function used to convert a packed numeric array (IntArray or FloatArray, see packNumbers of cJSON_ParseContext_t) into a generic list, so it can be modified using the list functions. Generic lists are left unchanged.
+ * 
+ * @param   GObjPtr Pointer to a heap allocated cJSON_Generic_t object, replaced by the generic list.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Datatype_Error if the GObj's type isn't a list or packed numeric array.
+ */
+cJSON_Result_t cJSON_tryUnpackList(cJSON_Generic_t *GObjPtr);
+
 #pragma endregion
 
 // - Parser Function -
@@ -58,6 +170,61 @@ cJSON_Result_t cJSON_delGenObj(cJSON_Generic_t GObj);
  * @return  cJSON_Result_t Returns cJSON_Ok by default. Can return one of the following errors: cJSON_DepthOutOfRange_Error, cJSON_Structure_Error, cJSON_InvalidCharacterSequence_Error.
  */
 cJSON_Result_t cJSON_parseStr(cJSON_Generic_t *GObjPtr, const char *str);
+/**
+ * @brief   cJSON parser functon using a reusable parse context. Avoids the per-call setup allocations of cJSON_parseStr, all scratch memory is kept in ctx between calls.
+ * 
+ * @param   ctx Parse context created using cJSON_createParseContext. If the context uses an arena, the parsed structure is owned by the context and stays valid until cJSON_resetParseContext or cJSON_deleteParseContext is called.
+ * @param   GObjPtr cJSON_Generic pointer, where the parsed structure will be saved in.
+ * @param   str String containing the JSON data.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Can return one of the following errors: cJSON_DepthOutOfRange_Error, cJSON_Structure_Error, cJSON_InvalidCharacterSequence_Error, cJSON_LimitExceeded_Error (see ctx->limits).
+ */
+cJSON_Result_t cJSON_parseStrWithContext(cJSON_ParseContext_t *ctx, cJSON_Generic_t *GObjPtr, const char *str);
+/**
+ * @brief   cJSON parser function with resource limits, for untrusted input. The parse is aborted as soon as a limit is exceeded, before the memory in question is allocated. The structure is heap allocated, like with cJSON_parseStr.
+ * 
+ * @param   GObjPtr cJSON_Generic pointer, where the parsed structure will be saved in.
+ * @param   str String containing the JSON data.
+ * @param   limits Pointer to the limits, members set to 0 are unlimited.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_LimitExceeded_Error if a limit is exceeded. Can return any error of cJSON_parseStr.
+ */
+cJSON_Result_t cJSON_parseStrWithLimits(cJSON_Generic_t *GObjPtr, const char *str, const cJSON_ParseLimits_t *limits);
+/**
+ * @brief   cJSON parser function for buffers of concatenated documents (objects or arrays, optionally separated by whitespace), e.g. "{..}{..}[..]". Successive documents are parsed using the same context until max documents are parsed or the buffer is used up. Bytes other than whitespace between documents are an error. A document that is cut off at the end of the buffer isn't an error, parsing stops in front of it, so it can be parsed again once the rest of it has arrived.
+ * 
+ * @param   ctx Parse context created using cJSON_createParseContext, shared by all documents. If the context uses an arena, all documents are owned by the context, otherwise every document is heap allocated and owned by the caller. Limits (ctx->limits) apply to each document separately.
+ * @param   buf Buffer, doesn't need to be null terminated.
+ * @param   len Length of the buffer in bytes.
+ * @param   results Array of max entries the parsed documents and their byte ranges are stored in.
+ * @param   max Maximum number of documents to parse.
+ * @param   count Pointer to a variable the number of parsed documents is stored in. Set on error as well, the documents parsed before the error are valid.
+ * @param   consumed Pointer to a variable the number of used up bytes is stored in: behind the last parsed document (and the whitespace following it). Parsing resumes at buf + *consumed.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if there are bytes other than whitespace in front of a document. Can return any error of cJSON_parseStrWithContext.
+ */
+cJSON_Result_t cJSON_parseMany(cJSON_ParseContext_t *ctx, const char *buf, size_t len, cJSON_DocSpan_t results[], size_t max, size_t *count, size_t *consumed);
+/**
+ * @brief   cJSON parser function that additionally records the source span of every container, so the document can later be updated incrementally using cJSON_reparse.
+ * 
+ * @param   doc Pointer to a cJSON_SpanDoc_t variable the heap allocated structure and its spans are stored in. Delete it using cJSON_deleteSpanDoc.
+ * @param   str String containing the JSON data.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_NotAllocated_Error if the span table could not grow. Can return one of the following errors: cJSON_DepthOutOfRange_Error, cJSON_Structure_Error, cJSON_InvalidCharacterSequence_Error.
+ */
+cJSON_Result_t cJSON_parseWithSpans(cJSON_SpanDoc_t *doc, const char *str);
+/**
+ * @brief   Function used to update a document after an edit of its text. Only the innermost container whose brackets enclose the edit is reparsed and its contents are replaced in place (the container object keeps its address). Falls back to parsing the whole text if the edit touches the root's brackets or changes the structure around the container.
+ * 
+ * @param   doc Document created using cJSON_parseWithSpans from oldText.
+ * @param   oldText Text before the edit.
+ * @param   newText Text after the edit.
+ * @param   edit Edited byte range.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. On error the document is left unchanged (still matching oldText). Can return any error of cJSON_parseWithSpans.
+ */
+cJSON_Result_t cJSON_reparse(cJSON_SpanDoc_t *doc, const char *oldText, const char *newText, cJSON_Edit_t edit);
+/**
+ * @brief   Function used to delete a document created using cJSON_parseWithSpans.
+ * 
+ * @param   doc Pointer to the document.
+ */
+void cJSON_deleteSpanDoc(cJSON_SpanDoc_t *doc);
 
 #pragma endregion
 
@@ -84,7 +251,7 @@ cJSON_Result_t cJSON_tryGetList(cJSON_Generic_t GObj, cJSON_List_t *list);
  * @brief   Function used to try and retrieve the string stored in GObj's dataContainer.
  * 
  * @param   GObj cJSON_Generic_t object.
- * @param   str Pointer to a user variable, where the string's contents are to be stored.
+ * @param   str Pointer to a user variable, where the string's contents are to be stored. Receives a heap allocated copy, use cJSON_tryGetStringPtr or cJSON_tryGetStringView to read the string without allocating.
  * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Datatype_Error if the GObj's type isn't a string.
  */
 cJSON_Result_t cJSON_tryGetString(cJSON_Generic_t GObj, cJSON_String_t *str);
@@ -112,6 +279,32 @@ cJSON_Result_t cJSON_tryGetFloat(cJSON_Generic_t GObj, cJSON_Float_t *floatVal);
  * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Datatype_Error if the GObj's type isn't a boolean.
  */
 cJSON_Result_t cJSON_tryGetBool(cJSON_Generic_t GObj, cJSON_Bool_t *boolVal);
+/**
+ * @brief   Function used to try and retrieve the value stored under a key of the dictionary in GObj's dataContainer. Doesn't allocate or modify the dictionary, so it can be used on frozen documents (see cJSON_freeze), where indexed dictionaries are looked up in constant time.
+ * 
+ * @param   GObj cJSON_Generic_t object.
+ * @param   key Key string.
+ * @param   valObj Pointer to a user variable, where the value is to be stored.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Datatype_Error if the GObj's type isn't a dictionary, cJSON_NotFound_Error if the key does not exist.
+ */
+cJSON_Result_t cJSON_tryGetDictValue(cJSON_Generic_t GObj, const cJSON_Key_t key, cJSON_Generic_t *valObj);
+/**
+ * @brief   Function used to try and retrieve the number of items of the list or packed numeric array in GObj's dataContainer.
+ * 
+ * @param   GObj cJSON_Generic_t object.
+ * @param   length Pointer to a user variable, where the number of items is to be stored.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Datatype_Error if the GObj's type isn't a list or packed numeric array.
+ */
+cJSON_Result_t cJSON_tryGetListLength(cJSON_Generic_t GObj, cJSON_object_size_size_t *length);
+/**
+ * @brief   Function used to try and retrieve an item of the list or packed numeric array in GObj's dataContainer. Items of packed arrays are returned as Integer or Float objects pointing into the array, which must not be deleted.
+ * 
+ * @param   GObj cJSON_Generic_t object.
+ * @param   index Index of the item.
+ * @param   item Pointer to a user variable, where the item is to be stored.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Datatype_Error if the GObj's type isn't a list or packed numeric array, cJSON_NotFound_Error if index is out of range.
+ */
+cJSON_Result_t cJSON_tryGetListItem(cJSON_Generic_t GObj, cJSON_object_size_size_t index, cJSON_Generic_t *item);
 
 #pragma endregion
 
@@ -142,6 +335,15 @@ cJSON_Result_t cJSON_tryGetListPtr(cJSON_Generic_t GObj, cJSON_List_t **listPtr)
  * @return cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Datatype_Error if the GObj's type isn't a string.
  */
 cJSON_Result_t cJSON_tryGetStringPtr(cJSON_Generic_t GObj, cJSON_String_t *strPtr);
+/**
+ * @brief   Function used to try and retrieve a borrowed view of the string stored in GObj's dataContainer. Neither copies nor scans the string, the length is taken from GObj.
+ * 
+ * @param   GObj cJSON_Generic_t object.
+ * @param   strPtr Pointer to a user pointer variable, where the pointer to the string is to be stored. Valid as long as the string isn't modified or deleted.
+ * @param   length Pointer to a user variable, where the string's length in bytes is to be stored. Embedded null characters (\u0000) are part of the length.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Datatype_Error if the GObj's type isn't a string.
+ */
+cJSON_Result_t cJSON_tryGetStringView(cJSON_Generic_t GObj, const char **strPtr, size_t *length);
 /**
  * @brief 
  * 
@@ -166,6 +368,24 @@ cJSON_Result_t cJSON_tryGetFloatPtr(cJSON_Generic_t GObj, cJSON_Float_t **floatV
  * @return cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Datatype_Error if the GObj's type isn't a boolean.
  */
 cJSON_Result_t cJSON_tryGetBoolPtr(cJSON_Generic_t GObj, cJSON_Bool_t **boolValPtr);
+/**
+ * @brief   Function used to try and retrieve the contiguous value array of the packed integer array in GObj's dataContainer.
+ * 
+ * @param   GObj cJSON_Generic_t object.
+ * @param   dataPtr Pointer to a user pointer variable, where the pointer to the first value is to be stored. Valid as long as the array isn't modified or deleted.
+ * @param   length Pointer to a user variable, where the number of values is to be stored.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Datatype_Error if the GObj's type isn't IntArray.
+ */
+cJSON_Result_t cJSON_tryGetIntArrayPtr(cJSON_Generic_t GObj, cJSON_Int_t **dataPtr, cJSON_object_size_size_t *length);
+/**
+ * @brief   Function used to try and retrieve the contiguous value array of the packed float array in GObj's dataContainer.
+ * 
+ * @param   GObj cJSON_Generic_t object.
+ * @param   dataPtr Pointer to a user pointer variable, where the pointer to the first value is to be stored. Valid as long as the array isn't modified or deleted.
+ * @param   length Pointer to a user variable, where the number of values is to be stored.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Datatype_Error if the GObj's type isn't FloatArray.
+ */
+cJSON_Result_t cJSON_tryGetFloatArrayPtr(cJSON_Generic_t GObj, cJSON_Float_t **dataPtr, cJSON_object_size_size_t *length);
 
 #pragma endregion
 
@@ -200,6 +420,23 @@ cJSON_Result_t cJSON_getRelDepth(cJSON_Generic_t GObj, cJSON_depth_t *maxDepth,
  */
 cJSON_Result_t cJSON_getAbsDepth(cJSON_Generic_t GObj, cJSON_depth_t *maxDepth);
 
+/**
+ * @brief   Function used to get a structural 64 bit hash of GObj. Dictionaries are hashed independent of their key order, lists dependent on their item order. Equal structures (see cJSON_equals) have equal hashes.
+ * 
+ * @param   GObj cJSON_Generic_t object.
+ * @return  uint64_t Structural hash.
+ */
+uint64_t cJSON_hash(cJSON_Generic_t GObj);
+/**
+ * @brief   Function used to compare two structures. Dictionaries are compared independent of their key order. Exits early on type or length mismatch.
+ * 
+ * @param   a First cJSON_Generic_t object.
+ * @param   b Second cJSON_Generic_t object.
+ * @return  true if both structures are equal.
+ * @return  false if the structures differ.
+ */
+bool cJSON_equals(cJSON_Generic_t a, cJSON_Generic_t b);
+
 #pragma endregion
 
 #endif
@@ -0,0 +1,123 @@
+/**
+ * @file cJSON_Arena.h
+ * @author HeCoding180
+ * @brief cJSON library arena (bump allocator) header file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_ARENA_DEFINED
+#define CJSON_ARENA_DEFINED
+
+#include <stddef.h>
+
+#include "cJSON_Types.h"
+
+//   ---   Typedefs   ---
+
+// - Struct Typedefs -
+#pragma region Struct Typedefs
+
+/**
+ * @brief   Single memory block of a cJSON_Arena_t. Blocks are chained in a singly linked list.
+ *
+ */
+typedef struct cJSON_ArenaBlock
+{
+    /**
+     * @brief   Next block in the arena's block chain.
+     *
+     */
+    struct cJSON_ArenaBlock *next;
+    /**
+     * @brief   Usable size of the block's data section in bytes.
+     *
+     */
+    size_t size;
+    /**
+     * @brief   Number of bytes of the data section that are already handed out.
+     *
+     */
+    size_t used;
+    /**
+     * @brief   Data section of the block.
+     *
+     */
+    unsigned char data[];
+} cJSON_ArenaBlock_t;
+
+/**
+ * @brief   Arena allocator. Memory handed out by an arena is never freed individually, it is released all at once by ARENA_Reset (memory is kept for reuse) or ARENA_Delete.
+ *
+ */
+typedef struct cJSON_Arena
+{
+    /**
+     * @brief   First block of the block chain.
+     *
+     */
+    cJSON_ArenaBlock_t *head;
+    /**
+     * @brief   Block allocations are currently served from.
+     *
+     */
+    cJSON_ArenaBlock_t *current;
+    /**
+     * @brief   Default size of newly allocated blocks.
+     *
+     */
+    size_t blockSize;
+} cJSON_Arena_t;
+
+#pragma endregion
+
+
+
+//   ---   Function Prototypes   ---
+
+// - Arena Functions -
+#pragma region Arena Functions
+
+/**
+ * @brief   Function used to create an empty arena. No memory is allocated until the first allocation request.
+ *
+ * @param   blockSize Default size of the arena's blocks in bytes. Larger requests get a dedicated block.
+ * @return  cJSON_Arena_t Empty arena.
+ */
+cJSON_Arena_t ARENA_Create(size_t blockSize);
+/**
+ * @brief   Frees all blocks of an arena. All memory handed out by the arena becomes invalid.
+ *
+ * @param   arena Pointer to a cJSON_Arena_t struct.
+ */
+void ARENA_Delete(cJSON_Arena_t *arena);
+/**
+ * @brief   Rewinds an arena without freeing its blocks, so they can be reused by subsequent allocations. All memory handed out by the arena becomes invalid.
+ *
+ * @param   arena Pointer to a cJSON_Arena_t struct.
+ */
+void ARENA_Reset(cJSON_Arena_t *arena);
+
+/**
+ * @brief   Allocates size bytes from the arena, aligned to CJSON_ARENA_ALIGN.
+ *
+ * @param   arena Pointer to a cJSON_Arena_t struct.
+ * @param   size Number of bytes to allocate.
+ * @return  void* Pointer to the allocated memory or NULL if the system is out of memory.
+ */
+void* ARENA_Alloc(cJSON_Arena_t *arena, size_t size);
+/**
+ * @brief   Resizes an allocation previously handed out by the arena. The allocation is extended in place if it is the most recent one of the current block, otherwise it is copied.
+ *
+ * @param   arena Pointer to a cJSON_Arena_t struct.
+ * @param   ptr Pointer to the previous allocation (may be NULL).
+ * @param   oldSize Size of the previous allocation in bytes.
+ * @param   newSize Requested size in bytes.
+ * @return  void* Pointer to the resized memory or NULL if the system is out of memory.
+ */
+void* ARENA_Realloc(cJSON_Arena_t *arena, void *ptr, size_t oldSize, size_t newSize);
+
+#pragma endregion
+
+#endif // CJSON_ARENA_DEFINED
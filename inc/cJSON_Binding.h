@@ -0,0 +1,137 @@
+/**
+ * @file cJSON_Binding.h
+ * @author HeCoding180
+ * @brief cJSON library binding header file. Contains the descriptor table based API used to parse JSON directly into C structs, without building a generic object tree.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_BINDING_DEFINED
+#define CJSON_BINDING_DEFINED
+
+#include <stddef.h>
+
+#include "cJSON_Types.h"
+
+//   ---   Macros   ---
+
+// - Descriptor Macros -
+#pragma region Descriptor Macros
+
+/**
+ * @brief   Field descriptor initializer for a scalar or string member of a struct.
+ * @param   structType Type of the struct the member belongs to.
+ * @param   member Name of the struct member.
+ * @param   key JSON key string the member is bound to.
+ * @param   fieldType cJSON_FieldType_t of the member.
+ */
+#define CJSON_FIELD(structType, member, key, fieldType) { (key), offsetof(structType, member), sizeof(((structType*)0)->member), (fieldType), NULL }
+/**
+ * @brief   Field descriptor initializer for a nested struct member.
+ * @param   structType Type of the struct the member belongs to.
+ * @param   member Name of the struct member.
+ * @param   key JSON key string the member is bound to.
+ * @param   nestedDesc cJSON_StructDesc_t describing the nested struct.
+ */
+#define CJSON_OBJECT_FIELD(structType, member, key, nestedDesc) { (key), offsetof(structType, member), sizeof(((structType*)0)->member), cJSON_ObjectField, &(nestedDesc) }
+/**
+ * @brief   Struct descriptor initializer for a static array of field descriptors.
+ * @param   fieldArray Array of cJSON_FieldDesc_t.
+ */
+#define CJSON_STRUCT_DESC(fieldArray) { (fieldArray), (uint16_t)(sizeof(fieldArray) / sizeof((fieldArray)[0])), 0, 0, NULL }
+
+#pragma endregion
+
+
+
+//   ---   Typedefs   ---
+
+// - Enum Typedefs -
+#pragma region Enum Typedefs
+
+typedef enum cJSON_FieldType
+{
+    cJSON_IntField,         // cJSON_Int_t member, accepts integers
+    cJSON_FloatField,       // cJSON_Float_t member, accepts integers and floats
+    cJSON_BoolField,        // cJSON_Bool_t member
+    cJSON_StringField,      // char* member, heap allocated copy owned by the struct (see cJSON_freeInto)
+    cJSON_CharArrayField,   // char[] member, string is copied into the array
+    cJSON_ObjectField       // Nested struct member, described by the field's nested descriptor
+} cJSON_FieldType_t;
+
+#pragma endregion
+
+// - Struct Typedefs -
+#pragma region Struct Typedefs
+
+struct cJSON_StructDesc;
+
+typedef struct cJSON_FieldDesc
+{
+    const char *key;
+    size_t offset;
+    size_t size;
+    cJSON_FieldType_t type;
+    struct cJSON_StructDesc *nested;
+} cJSON_FieldDesc_t;
+
+/**
+ * @brief   Describes a struct as a table of fields. The key dispatch table (seed, slotMask, slots) is built by cJSON_compileStructDesc, descriptors that aren't compiled fall back to a linear key search.
+ *
+ */
+typedef struct cJSON_StructDesc
+{
+    const cJSON_FieldDesc_t *fields;
+    uint16_t fieldCount;
+
+    uint64_t seed;
+    uint32_t slotMask;
+    uint16_t *slots;
+} cJSON_StructDesc_t;
+
+#pragma endregion
+
+
+
+//   ---   Function Prototypes   ---
+
+// - Binding Functions -
+#pragma region Binding Functions
+
+/**
+ * @brief   Function used to build the key dispatch table of a descriptor and all of its nested descriptors. Searches a hash seed for which every key maps to its own slot (perfect hash), so a key lookup costs one hash and one compare.
+ *
+ * @param   desc Struct descriptor.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_NotAllocated_Error if the table could not be allocated, cJSON_DuplicateKey_Error if two fields are bound to the same key, cJSON_LimitExceeded_Error if no table of up to 65536 slots separates the keys. Errors of nested descriptors are passed through.
+ */
+cJSON_Result_t cJSON_compileStructDesc(cJSON_StructDesc_t *desc);
+/**
+ * @brief   Function used to free the key dispatch tables built by cJSON_compileStructDesc.
+ *
+ * @param   desc Struct descriptor.
+ */
+void cJSON_releaseStructDesc(cJSON_StructDesc_t *desc);
+
+/**
+ * @brief   Function used to parse a JSON dictionary directly into a struct. Values are written straight to the described members, keys without a field descriptor are skipped (but validated) and null values leave the member untouched.
+ *          Members not present in the JSON data keep their previous value, so the struct should be zero initialized.
+ *
+ * @param   desc Struct descriptor.
+ * @param   structPtr Pointer to the struct.
+ * @param   ptr Pointer to the JSON data (does not need to be null terminated).
+ * @param   len Length of the JSON data in bytes.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Datatype_Error if a value does not match its member's type, cJSON_LimitExceeded_Error if a string does not fit its char array member. Can return one of the following parser errors: cJSON_DepthOutOfRange_Error, cJSON_Structure_Error, cJSON_InvalidCharacterSequence_Error.
+ */
+cJSON_Result_t cJSON_parseInto(const cJSON_StructDesc_t *desc, void *structPtr, const char *ptr, size_t len);
+/**
+ * @brief   Function used to free the heap allocated strings (cJSON_StringField members) of a struct filled by cJSON_parseInto.
+ *
+ * @param   desc Struct descriptor.
+ * @param   structPtr Pointer to the struct.
+ */
+void cJSON_freeInto(const cJSON_StructDesc_t *desc, void *structPtr);
+
+#pragma endregion
+
+#endif // CJSON_BINDING_DEFINED
@@ -0,0 +1,113 @@
+/**
+ * @file cJSON_Columns.h
+ * @author HeCoding180
+ * @brief cJSON library columns header file. Contains the API used to extract typed, contiguous columns from a list of records (dictionaries).
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_COLUMNS_DEFINED
+#define CJSON_COLUMNS_DEFINED
+
+#include <stddef.h>
+
+#include "cJSON_Types.h"
+
+//   ---   Macros   ---
+
+// - Column Macros -
+#pragma region Column Macros
+
+/**
+ * @brief   Checks if a cell of a column holds a value, i.e. the record at row had the column's key with a value of the column's type.
+ * @param   column cJSON_Column_t.
+ * @param   row Row (record index).
+ */
+#define CJSON_COLUMN_IS_VALID(column, row) ((((column).validity[(row) >> 3]) >> ((row) & 7U)) & 1U)
+
+#pragma endregion
+
+
+
+//   ---   Typedefs   ---
+
+// - Enum Typedefs -
+#pragma region Enum Typedefs
+
+typedef enum cJSON_ColumnType
+{
+    cJSON_IntColumn,        // cJSON_Int_t values, accepts integers
+    cJSON_FloatColumn,      // cJSON_Float_t values, accepts integers and floats
+    cJSON_BoolColumn,       // cJSON_Bool_t values
+    cJSON_StringColumn      // const char* values, borrowed from the tree (valid as long as the tree isn't modified or deleted)
+} cJSON_ColumnType_t;
+
+#pragma endregion
+
+// - Struct Typedefs -
+#pragma region Struct Typedefs
+
+/**
+ * @brief   Column extracted by cJSON_extractColumns. Its buffers are deleted using cJSON_deleteColumns.
+ *
+ */
+typedef struct cJSON_Column
+{
+    /**
+     * @brief   Type of the column's values, set by the caller before extracting.
+     *
+     */
+    cJSON_ColumnType_t type;
+    /**
+     * @brief   Contiguous value buffer with one value per record, element type according to type. Invalid cells are zero (NULL for strings).
+     *
+     */
+    void *data;
+    /**
+     * @brief   Validity bitmap, bit (row % 8) of byte (row / 8) is set if the cell holds a value (see CJSON_COLUMN_IS_VALID).
+     *
+     */
+    uint8_t *validity;
+    /**
+     * @brief   Number of cells (records).
+     *
+     */
+    size_t length;
+    /**
+     * @brief   Number of cells whose key was missing or whose value had a different type.
+     *
+     */
+    size_t invalidCount;
+} cJSON_Column_t;
+
+#pragma endregion
+
+
+
+//   ---   Function Prototypes   ---
+
+// - Column Functions -
+#pragma region Column Functions
+
+/**
+ * @brief   Function used to extract columns from a list of records in a single pass. Every record's value for keys[i] is stored in outColumns[i]. The slot a key was found at in the previous record is checked first, so records sharing their key order need no key search. Records that aren't dictionaries, missing keys and values of other types are marked as invalid in the column's validity bitmap.
+ *
+ * @param   list List of records.
+ * @param   keys Array of nkeys key strings.
+ * @param   nkeys Number of keys (columns).
+ * @param   outColumns Array of nkeys columns. The type of every column has to be set, the remaining members are set by the function.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Datatype_Error if list isn't a list, cJSON_NotAllocated_Error if a column buffer could not be allocated (no buffers are left allocated then).
+ */
+cJSON_Result_t cJSON_extractColumns(cJSON_Generic_t list, const char *const keys[], size_t nkeys, cJSON_Column_t *outColumns);
+/**
+ * @brief   Function used to free the buffers of columns extracted using cJSON_extractColumns.
+ *
+ * @param   columns Array of columns.
+ * @param   nColumns Number of columns.
+ */
+void cJSON_deleteColumns(cJSON_Column_t *columns, size_t nColumns);
+
+#pragma endregion
+
+#endif // CJSON_COLUMNS_DEFINED
@@ -7,6 +7,9 @@
  * 
  */
 
+#ifndef CJSON_CONSTANTS_DEFINED
+#define CJSON_CONSTANTS_DEFINED
+
 #include "cJSON_Types.h"
 
 /**
@@ -22,7 +25,81 @@
 #define CJSON_MAX_NUM_LEN               32u
 
 /**
- * @brief   Size of the cJSON parser StringBuilder's preBuffer. Max: 255U
+ * @brief   Initial capacity of the cJSON parser StringBuilder's buffer. The buffer doubles its capacity whenever it is full.
+ * 
+ */
+#define CJSON_PARSE_STRING_INIT_SIZE    32U
+
+/**
+ * @brief   Initial capacity of dictionaries and lists. Containers double their capacity whenever they are full.
+ * 
+ */
+#define CJSON_CONTAINER_INIT_CAPACITY   4U
+
+/**
+ * @brief   Size of a dictionary's inline key slots in bytes. Keys shorter than this (terminator included) are stored in the key array's allocation instead of a separate one.
+ * 
+ */
+#define CJSON_KEY_INLINE_SIZE           16U
+
+/**
+ * @brief   Minimum length of a dictionary for which cJSON_freeze builds a key hash index. Shorter dictionaries get a sorted key table (see CJSON_DICT_SORT_MIN_LENGTH).
+ * 
+ */
+#define CJSON_DICT_INDEX_MIN_LENGTH     256U
+
+/**
+ * @brief   Minimum length of a dictionary for which a sorted key table is built. Shorter dictionaries are searched linearly.
+ * 
+ */
+#define CJSON_DICT_SORT_MIN_LENGTH      8U
+
+/**
+ * @brief   Number of siblings a cJSON_Iter_t looks ahead when prefetching the nodes of upcoming values.
+ * 
+ */
+#define CJSON_ITER_PREFETCH_DISTANCE    2U
+
+/**
+ * @brief   Default size of a cJSON_Arena_t memory block in bytes.
  * 
  */
-#define CJSON_PARSE_STRING_PB_SIZE      10U
\ No newline at end of file
+#define CJSON_ARENA_BLOCK_SIZE          4096U
+
+/**
+ * @brief   Alignment of memory handed out by a cJSON_Arena_t in bytes. Needs to be a power of two.
+ * 
+ */
+#define CJSON_ARENA_ALIGN               8U
+
+/**
+ * @brief   Number of independently locked shards of a cJSON_DocCache_t. Needs to be a power of two.
+ * 
+ */
+#define CJSON_DOC_CACHE_SHARDS          16U
+
+/**
+ * @brief   Maximum container nesting depth of a cJSON_Writer_t.
+ * 
+ */
+#define CJSON_WRITER_MAX_DEPTH          256U
+
+/**
+ * @brief   Number of buffered bytes at which a flushing cJSON_Writer_t passes its buffer on to the output.
+ * 
+ */
+#define CJSON_WRITER_FLUSH_SIZE         4096U
+
+/**
+ * @brief   Default size of the blocks read by cJSON_parseFilePipelined in bytes.
+ * 
+ */
+#define CJSON_PIPELINE_BLOCK_SIZE       (1U << 20)
+
+/**
+ * @brief   Default number of blocks in the ring buffer of cJSON_parseFilePipelined.
+ * 
+ */
+#define CJSON_PIPELINE_RING_SIZE        4U
+
+#endif
\ No newline at end of file
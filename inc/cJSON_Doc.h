@@ -0,0 +1,89 @@
+/**
+ * @file cJSON_Doc.h
+ * @author HeCoding180
+ * @brief cJSON library document header file. Contains frozen (immutable) documents that can be shared between threads using atomic reference counting.
+ *
+ *        A frozen document must not be modified: pass its objects only to read-only functions (getters, cJSON_hash, cJSON_equals, cJSON_clone, cJSON_diff, cJSON_getRelDepth, cJSON_getAbsDepth).
+ *        These don't write to the tree, so any number of threads can call them on the same document without locks. Mutation functions and cJSON_delGenObj must not be used on frozen objects.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_DOC_DEFINED
+#define CJSON_DOC_DEFINED
+
+#include <stdatomic.h>
+
+#include "cJSON_Arena.h"
+#include "cJSON_Types.h"
+
+//   ---   Typedefs   ---
+
+// - Struct Typedefs -
+#pragma region Struct Typedefs
+
+/**
+ * @brief   Frozen document. Created using cJSON_freeze, shared using cJSON_docRetain and freed by the last cJSON_docRelease.
+ *
+ */
+typedef struct cJSON_Doc
+{
+    /**
+     * @brief   Root object of the frozen tree.
+     *
+     */
+    cJSON_Generic_t root;
+    /**
+     * @brief   Arena holding the compacted tree, its sorted key tables and key indexes.
+     *
+     */
+    cJSON_Arena_t arena;
+    /**
+     * @brief   Number of references held on the document.
+     *
+     */
+    atomic_uint_fast32_t refCount;
+} cJSON_Doc_t;
+
+#pragma endregion
+
+
+
+//   ---   Function Prototypes   ---
+
+// - Document Functions -
+#pragma region Document Functions
+
+/**
+ * @brief   Function used to create a frozen document from a tree. The tree is compacted into one contiguous block (see cJSON_clone) and dictionaries of at least CJSON_DICT_SORT_MIN_LENGTH entries get a sorted key table (binary search), dictionaries of at least CJSON_DICT_INDEX_MIN_LENGTH entries a key hash index (constant time key lookups, see cJSON_tryGetDictValue).
+ *
+ * @param   GObj Tree that is to be frozen. It is copied, the caller keeps ownership of GObj.
+ * @param   docPtr Pointer to a variable the new document is stored in. The document starts with a reference count of 1.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_NotAllocated_Error if the memory for the document could not be allocated.
+ */
+cJSON_Result_t cJSON_freeze(cJSON_Generic_t GObj, cJSON_Doc_t **docPtr);
+/**
+ * @brief   Function used to take an additional reference on a document. Thread-safe.
+ *
+ * @param   doc Document.
+ * @return  cJSON_Doc_t* doc, for convenience.
+ */
+cJSON_Doc_t* cJSON_docRetain(cJSON_Doc_t *doc);
+/**
+ * @brief   Function used to drop a reference on a document. The last release frees the document. Thread-safe.
+ *
+ * @param   doc Document. Must not be used by the caller afterwards.
+ */
+void cJSON_docRelease(cJSON_Doc_t *doc);
+/**
+ * @brief   Function used to get the root object of a document.
+ *
+ * @param   doc Document.
+ * @return  cJSON_Generic_t Root object (read-only).
+ */
+cJSON_Generic_t cJSON_docRoot(const cJSON_Doc_t *doc);
+
+#pragma endregion
+
+#endif // CJSON_DOC_DEFINED
@@ -0,0 +1,133 @@
+/**
+ * @file cJSON_DocCache.h
+ * @author HeCoding180
+ * @brief cJSON library document cache header file. Contains a content addressed, size bounded cache of frozen documents keyed by the hash of their JSON input.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_DOC_CACHE_DEFINED
+#define CJSON_DOC_CACHE_DEFINED
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "cJSON_Constants.h"
+#include "cJSON_Doc.h"
+#include "cJSON_Types.h"
+
+//   ---   Typedefs   ---
+
+// - Struct Typedefs -
+#pragma region Struct Typedefs
+
+/**
+ * @brief   Cached document together with the input it was parsed from.
+ *
+ */
+typedef struct cJSON_DocCacheEntry
+{
+    uint64_t hash;
+    char *src;
+    size_t srcLen;
+    cJSON_Doc_t *doc;
+    /**
+     * @brief   Memory accounted to the entry in bytes (input copy and document).
+     *
+     */
+    size_t cost;
+    /**
+     * @brief   CLOCK reference bit, set on every hit and cleared when the clock hand passes the entry.
+     *
+     */
+    bool referenced;
+} cJSON_DocCacheEntry_t;
+
+/**
+ * @brief   Independently locked part of a cache. Entries are stored in an open addressing table (linear probing), the CLOCK hand sweeps the table's slots.
+ *
+ */
+typedef struct cJSON_DocCacheShard
+{
+    pthread_mutex_t lock;
+
+    cJSON_DocCacheEntry_t *slots;
+    size_t slotMask;
+    size_t length;
+    size_t hand;
+
+    size_t usedBytes;
+    size_t maxBytes;
+} cJSON_DocCacheShard_t;
+
+/**
+ * @brief   Document cache. Created using cJSON_createDocCache and deleted using cJSON_deleteDocCache.
+ *
+ */
+typedef struct cJSON_DocCache
+{
+    cJSON_DocCacheShard_t shards[CJSON_DOC_CACHE_SHARDS];
+
+    atomic_uint_fast64_t hits;
+    atomic_uint_fast64_t misses;
+    atomic_uint_fast64_t evictions;
+} cJSON_DocCache_t;
+
+/**
+ * @brief   Snapshot of a cache's counters.
+ *
+ */
+typedef struct cJSON_DocCacheStats
+{
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    size_t entries;
+    size_t usedBytes;
+} cJSON_DocCacheStats_t;
+
+#pragma endregion
+
+
+
+//   ---   Function Prototypes   ---
+
+// - Document Cache Functions -
+#pragma region Document Cache Functions
+
+/**
+ * @brief   Function used to create a document cache.
+ *
+ * @param   maxBytes Memory budget of the cache in bytes, split evenly between its shards. Documents that exceed a shard's budget on their own aren't cached.
+ * @return  cJSON_DocCache_t* Pointer to the new cache. NULL if it could not be allocated.
+ */
+cJSON_DocCache_t* cJSON_createDocCache(size_t maxBytes);
+/**
+ * @brief   Function used to delete a document cache. Documents still retained by users stay valid until they are released.
+ *
+ * @param   cache Pointer to the cache.
+ */
+void cJSON_deleteDocCache(cJSON_DocCache_t *cache);
+
+/**
+ * @brief   Function used to get the frozen document for a JSON string. The input bytes are hashed and looked up first, only inputs that aren't cached are parsed (and inserted, evicting entries using CLOCK if the shard's budget is exceeded). Thread-safe.
+ *
+ * @param   cache Pointer to the cache.
+ * @param   str JSON string.
+ * @param   docPtr Pointer to a variable the document is stored in. The document is retained for the caller, who has to release it using cJSON_docRelease.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_NotAllocated_Error if memory could not be allocated. Can return any error of cJSON_parseStr.
+ */
+cJSON_Result_t cJSON_docCacheParse(cJSON_DocCache_t *cache, const char *str, cJSON_Doc_t **docPtr);
+
+/**
+ * @brief   Function used to read a cache's counters. Thread-safe.
+ *
+ * @param   cache Pointer to the cache.
+ * @param   stats Pointer to a user variable, where the counters are to be stored.
+ */
+void cJSON_getDocCacheStats(cJSON_DocCache_t *cache, cJSON_DocCacheStats_t *stats);
+
+#pragma endregion
+
+#endif // CJSON_DOC_CACHE_DEFINED
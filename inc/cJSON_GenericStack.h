@@ -166,6 +166,12 @@ cJSON_GenericStack_t GS_Create(cJSON_depth_t stackSize);
  * @param   TSptr Pointer to a cJSON_GenericStack_t struct.
  */
 void GS_Delete(cJSON_GenericStack_t *TSptr);
+/**
+ * @brief   Removes all items from the stack while keeping its allocated stack memory for reuse.
+ * 
+ * @param   TSptr Pointer to a cJSON_GenericStack_t struct.
+ */
+void GS_Clear(cJSON_GenericStack_t *TSptr);
 
 /**
  * @brief   Used to push a cJSON_Generic_t value to the stack.
@@ -0,0 +1,42 @@
+/**
+ * @file cJSON_Hash.h
+ * @author HeCoding180
+ * @brief cJSON library hash header file. Contains the fast 64 bit hash used for keys, scalars and raw input bytes.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_HASH_DEFINED
+#define CJSON_HASH_DEFINED
+
+#include <stddef.h>
+
+#include "cJSON_Types.h"
+
+//   ---   Function Prototypes   ---
+
+// - Hash Functions -
+#pragma region Hash Functions
+
+/**
+ * @brief   Function used to hash a range of bytes. Processes 16 bytes per round using 64x64->128 bit multiply-fold mixing.
+ *
+ * @param   data Pointer to the bytes that are to be hashed.
+ * @param   len Number of bytes.
+ * @param   seed Hash seed, different seeds yield independent hashes.
+ * @return  uint64_t 64 bit hash.
+ */
+uint64_t HASH_Bytes(const void *data, size_t len, uint64_t seed);
+/**
+ * @brief   Function used to mix two 64 bit values into one well distributed 64 bit hash.
+ *
+ * @param   a First value.
+ * @param   b Second value.
+ * @return  uint64_t 64 bit hash.
+ */
+uint64_t HASH_Mix(uint64_t a, uint64_t b);
+
+#pragma endregion
+
+#endif // CJSON_HASH_DEFINED
@@ -0,0 +1,183 @@
+/**
+ * @file cJSON_Iter.h
+ * @author HeCoding180
+ * @brief cJSON library iterator header file. Contains a non-recursive cursor used to traverse a structure depth-first or breadth-first.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_ITER_DEFINED
+#define CJSON_ITER_DEFINED
+
+#include <stddef.h>
+
+#include "cJSON_StringDoubleBuffer.h"
+#include "cJSON_Types.h"
+
+//   ---   Typedefs   ---
+
+// - Enum Typedefs -
+#pragma region Enum Typedefs
+
+typedef enum cJSON_IterOrder
+{
+    cJSON_DepthFirst,       // Pre-order depth-first, containers are entered before and left after their children
+    cJSON_BreadthFirst      // Breadth-first (level order), containers are entered only, there are no leave events
+} cJSON_IterOrder_t;
+
+typedef enum cJSON_IterEvent
+{
+    cJSON_IterEnter,        // Current value is a container (Dictionary, List, IntArray or FloatArray), its children follow unless it is skipped
+    cJSON_IterLeave,        // All children of the current container have been visited (depth-first only)
+    cJSON_IterValue         // Current value isn't a container
+} cJSON_IterEvent_t;
+
+#pragma endregion
+
+// - Struct Typedefs -
+#pragma region Struct Typedefs
+
+/**
+ * @brief   Open container of a depth-first traversal.
+ *
+ */
+typedef struct cJSON_IterFrame
+{
+    cJSON_Generic_t container;
+    /**
+     * @brief   Index of the container's next child.
+     *
+     */
+    cJSON_object_size_size_t next;
+} cJSON_IterFrame_t;
+
+/**
+ * @brief   Queued value of a breadth-first traversal.
+ *
+ */
+typedef struct cJSON_IterNode
+{
+    cJSON_Generic_t value;
+    /**
+     * @brief   Queue position of the enclosing container, SIZE_MAX for the root.
+     *
+     */
+    size_t parent;
+    cJSON_object_size_size_t index;
+    size_t depth;
+} cJSON_IterNode_t;
+
+/**
+ * @brief   Traversal cursor. Created using cJSON_createIter, advanced using cJSON_iterNext and deleted using cJSON_deleteIter. The structure must not be modified while it is traversed.
+ *
+ */
+typedef struct cJSON_Iter
+{
+    cJSON_IterOrder_t order;
+
+    /**
+     * @brief   Event of the current step.
+     *
+     */
+    cJSON_IterEvent_t event;
+    /**
+     * @brief   Current value. Items of packed arrays are Integer or Float objects pointing into the array (see cJSON_getListItem).
+     *
+     */
+    cJSON_Generic_t value;
+    /**
+     * @brief   Key of the current value if its container is a dictionary, NULL otherwise.
+     *
+     */
+    const char *key;
+    /**
+     * @brief   Index of the current value within its container, 0 for the root.
+     *
+     */
+    cJSON_object_size_size_t index;
+    /**
+     * @brief   Depth of the current value, 0 for the root.
+     *
+     */
+    size_t depth;
+
+    /**
+     * @brief   Explicit stack of open containers (depth-first).
+     *
+     */
+    cJSON_IterFrame_t *frames;
+    size_t frameCount;
+    size_t frameCapacity;
+
+    /**
+     * @brief   Queue of values (breadth-first). Dequeued values are kept, so the path of the current value can be followed back to the root.
+     *
+     */
+    cJSON_IterNode_t *queue;
+    size_t queueHead;
+    size_t queueLength;
+    size_t queueCapacity;
+
+    cJSON_Generic_t root;
+    bool started;
+    /**
+     * @brief   Set on enter events, cleared by cJSON_iterSkip. The children of the current container are visited next if set.
+     *
+     */
+    bool descend;
+    /**
+     * @brief   Scratch buffer of cJSON_iterPath.
+     *
+     */
+    cJSON_SDB_t path;
+} cJSON_Iter_t;
+
+#pragma endregion
+
+
+
+//   ---   Function Prototypes   ---
+
+// - Iterator Functions -
+#pragma region Iterator Functions
+
+/**
+ * @brief   Function used to create a cursor over a structure. The cursor is positioned before the root, the first call of cJSON_iterNext moves it to the root.
+ *
+ * @param   root Root of the structure.
+ * @param   order Traversal order.
+ * @return  cJSON_Iter_t Cursor. Memory is allocated on demand while traversing.
+ */
+cJSON_Iter_t cJSON_createIter(cJSON_Generic_t root, cJSON_IterOrder_t order);
+/**
+ * @brief   Function used to free the memory of a cursor. The structure itself is left untouched.
+ *
+ * @param   iter Pointer to the cursor.
+ */
+void cJSON_deleteIter(cJSON_Iter_t *iter);
+
+/**
+ * @brief   Function used to move a cursor to the next step of the traversal. Uses an explicit stack (or queue), so the depth of the structure is only limited by memory. The nodes of upcoming siblings are prefetched.
+ *
+ * @param   iter Pointer to the cursor.
+ * @return  cJSON_Result_t Returns cJSON_Ok if the cursor was moved (see iter->event, iter->value, iter->key, iter->index and iter->depth). Returns cJSON_NotFound_Error once the traversal is complete, cJSON_NotAllocated_Error if the stack or queue could not grow (the cursor stays at its position).
+ */
+cJSON_Result_t cJSON_iterNext(cJSON_Iter_t *iter);
+/**
+ * @brief   Function used to skip the children of the container the cursor was just moved to (enter event). A depth-first cursor moves on to the container's leave event.
+ *
+ * @param   iter Pointer to the cursor.
+ */
+void cJSON_iterSkip(cJSON_Iter_t *iter);
+/**
+ * @brief   Function used to get the JSON pointer (RFC 6901) of the current value, e.g. "/users/3/name". The root's pointer is the empty string.
+ *
+ * @param   iter Pointer to the cursor.
+ * @return  const char* JSON pointer, owned by the cursor and valid until the next call of cJSON_iterPath or cJSON_deleteIter.
+ */
+const char* cJSON_iterPath(cJSON_Iter_t *iter);
+
+#pragma endregion
+
+#endif // CJSON_ITER_DEFINED
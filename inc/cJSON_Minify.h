@@ -0,0 +1,76 @@
+/**
+ * @file cJSON_Minify.h
+ * @author HeCoding180
+ * @brief cJSON library minifier header file. Contains the allocation free in place minifier and its streaming variant.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_MINIFY_DEFINED
+#define CJSON_MINIFY_DEFINED
+
+#include <stddef.h>
+
+#include "cJSON_Types.h"
+
+//   ---   Typedefs   ---
+
+// - Struct Typedefs -
+#pragma region Struct Typedefs
+
+/**
+ * @brief   State of a streaming minifier, carried from one chunk to the next. Initialize it using cJSON_initMinifier.
+ *
+ */
+typedef struct cJSON_Minifier
+{
+    /**
+     * @brief   True if the last chunk ended inside a string.
+     *
+     */
+    bool inString;
+    /**
+     * @brief   True if the last chunk ended behind a string's backslash.
+     *
+     */
+    bool escape;
+} cJSON_Minifier_t;
+
+#pragma endregion
+
+
+
+//   ---   Function Prototypes   ---
+
+// - Minifier Functions -
+#pragma region Minifier Functions
+
+/**
+ * @brief   Function used to remove all insignificant whitespace (whitespace outside of strings) from JSON data in place. Works on the raw text without building a structure or allocating memory, the data isn't validated.
+ *
+ * @param   buf Pointer to the JSON data. The minified data is written to its beginning and null terminated if it got shorter.
+ * @param   len Length of the JSON data in bytes.
+ * @return  size_t Length of the minified data in bytes.
+ */
+size_t cJSON_minify(char *buf, size_t len);
+
+/**
+ * @brief   Function used to initialize a streaming minifier.
+ *
+ * @param   minifier Pointer to the minifier.
+ */
+void cJSON_initMinifier(cJSON_Minifier_t *minifier);
+/**
+ * @brief   Function used to minify the next chunk of a JSON document in place. Chunks may be split anywhere, including inside strings and escape sequences.
+ *
+ * @param   minifier Pointer to the minifier.
+ * @param   buf Pointer to the chunk. The minified chunk is written to its beginning, it is not null terminated.
+ * @param   len Length of the chunk in bytes.
+ * @return  size_t Length of the minified chunk in bytes.
+ */
+size_t cJSON_minifyChunk(cJSON_Minifier_t *minifier, char *buf, size_t len);
+
+#pragma endregion
+
+#endif // CJSON_MINIFY_DEFINED
@@ -0,0 +1,170 @@
+/**
+ * @file cJSON_ParseContext.h
+ * @author HeCoding180
+ * @brief cJSON library parse context header file. A parse context bundles all scratch memory the parser needs, so it can be reused for many parse calls without per-call setup allocations.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_PARSE_CONTEXT_DEFINED
+#define CJSON_PARSE_CONTEXT_DEFINED
+
+#include "cJSON_Arena.h"
+#include "cJSON_Constants.h"
+#include "cJSON_GenericStack.h"
+#include "cJSON_SourceSpan.h"
+#include "cJSON_StringDoubleBuffer.h"
+#include "cJSON_Types.h"
+
+//   ---   Typedefs   ---
+
+// - Struct Typedefs -
+#pragma region Struct Typedefs
+
+/**
+ * @brief   Resource limits of a parse. A limit of 0 means unlimited. Exceeding a limit aborts the parse with cJSON_LimitExceeded_Error.
+ *
+ */
+typedef struct cJSON_ParseLimits
+{
+    /**
+     * @brief   Maximum number of bytes of the parsed structure (values, strings, keys and container slots, without allocator overhead or unused capacity).
+     *
+     */
+    size_t maxBytes;
+    /**
+     * @brief   Maximum number of parsed values (containers included).
+     *
+     */
+    size_t maxNodes;
+    /**
+     * @brief   Maximum length of a string value or key in bytes (after decoding escape sequences).
+     *
+     */
+    size_t maxStringLength;
+    /**
+     * @brief   Maximum nesting depth, the root container has depth 1. Structures nested deeper than CJSON_MAX_DEPTH are rejected with cJSON_DepthOutOfRange_Error regardless.
+     *
+     */
+    cJSON_depth_t maxDepth;
+} cJSON_ParseLimits_t;
+
+/**
+ * @brief   Long-lived parser state. Create it once using cJSON_createParseContext, pass it to any number of cJSON_parseStrWithContext calls and delete it using cJSON_deleteParseContext.
+ *
+ */
+typedef struct cJSON_ParseContext
+{
+    /**
+     * @brief   Object stack used to track the currently open containers.
+     *
+     */
+    cJSON_GenericStack_t objectStack;
+    /**
+     * @brief   Scratch buffer for string values.
+     *
+     */
+    cJSON_SDB_t strBuffer;
+    /**
+     * @brief   Scratch buffer for the active dictionary key.
+     *
+     */
+    cJSON_SDB_t keyBuffer;
+    /**
+     * @brief   Scratch buffer for number strings.
+     *
+     */
+    char numBuffer[CJSON_MAX_NUM_LEN + 1];
+    /**
+     * @brief   True if parsed structures are allocated from the context's arena instead of the heap.
+     *
+     */
+    bool useArena;
+    /**
+     * @brief   Parser flags of the structure being parsed, kept between calls for incremental parsing.
+     *
+     */
+    uint8_t parserFlags;
+    /**
+     * @brief   If set, a sorted key table (see cJSON_Dict_t) is built for every parsed dictionary of at least CJSON_DICT_SORT_MIN_LENGTH entries. Only used if useArena is set. False by default.
+     *
+     */
+    bool sortKeys;
+    /**
+     * @brief   If set, lists whose items are all integers or all floats are stored as packed numeric arrays (IntArray, FloatArray) instead of lists of generic objects. Not used while spans are recorded. False by default.
+     *
+     */
+    bool packNumbers;
+    /**
+     * @brief   Arena parsed structures are allocated from if useArena is set.
+     *
+     */
+    cJSON_Arena_t arena;
+    /**
+     * @brief   Span table the source spans of parsed containers are recorded in. NULL (default) if no spans are recorded.
+     *
+     */
+    cJSON_SpanTable_t *spans;
+    /**
+     * @brief   Resource limits, unlimited by default.
+     *
+     */
+    cJSON_ParseLimits_t limits;
+    /**
+     * @brief   Number of values charged against limits.maxNodes by the current parse.
+     *
+     */
+    size_t nodeCount;
+    /**
+     * @brief   Number of bytes charged against limits.maxBytes by the current parse.
+     *
+     */
+    size_t byteCount;
+    /**
+     * @brief   Pointer recorded span offsets are relative to.
+     *
+     */
+    const char *spanBase;
+} cJSON_ParseContext_t;
+
+#pragma endregion
+
+
+
+//   ---   Function Prototypes   ---
+
+// - Parse Context Functions -
+#pragma region Parse Context Functions
+
+/**
+ * @brief   Function used to create a parse context.
+ *
+ * @param   useArena If true, structures parsed with this context are allocated from the context's arena. They stay valid until the context is reset or deleted and must not be deleted using cJSON_delGenObj. If false, parsed structures are heap allocated and owned by the caller.
+ * @return  cJSON_ParseContext_t Parse context with allocated object stack.
+ */
+cJSON_ParseContext_t cJSON_createParseContext(bool useArena);
+/**
+ * @brief   Function used to release all structures allocated from the context's arena. All memory is kept for reuse by subsequent parse calls.
+ *
+ * @param   ctx Pointer to a cJSON_ParseContext_t struct.
+ */
+void cJSON_resetParseContext(cJSON_ParseContext_t *ctx);
+/**
+ * @brief   Function used to free all memory held by a parse context, including structures allocated from its arena.
+ *
+ * @param   ctx Pointer to a cJSON_ParseContext_t struct.
+ */
+void cJSON_deleteParseContext(cJSON_ParseContext_t *ctx);
+
+/**
+ * @brief   Function used to get the arena the context allocates parsed structures from.
+ *
+ * @param   ctx Pointer to a cJSON_ParseContext_t struct.
+ * @return  cJSON_Arena_t* Pointer to the context's arena, NULL if the context allocates from the heap.
+ */
+cJSON_Arena_t* cJSON_getParseContextArena(cJSON_ParseContext_t *ctx);
+
+#pragma endregion
+
+#endif // CJSON_PARSE_CONTEXT_DEFINED
@@ -12,6 +12,8 @@
 
 #include "../inc/cJSON_Constants.h"
 #include "../inc/cJSON_GenericStack.h"
+#include "../inc/cJSON_ParseContext.h"
+#include "../inc/cJSON_StringDoubleBuffer.h"
 #include "../inc/cJSON_Types.h"
 #include "../inc/cJSON_Util.h"
 
@@ -30,6 +32,26 @@
 
 #pragma endregion
 
+// - Character Class Defines -
+#pragma region Character Class Defines
+
+#define CJP_CLASS_INVALID           0U      // Character that can't start a token
+#define CJP_CLASS_WHITESPACE        1U      // " ", "\t", "\n", "\r"
+#define CJP_CLASS_DICT_START        2U      // "{"
+#define CJP_CLASS_LIST_START        3U      // "["
+#define CJP_CLASS_DICT_END          4U      // "}"
+#define CJP_CLASS_LIST_END          5U      // "]"
+#define CJP_CLASS_ITEM_SEPT         6U      // ","
+#define CJP_CLASS_DICT_SEPT         7U      // ":"
+#define CJP_CLASS_STRING            8U      // Opening quote
+#define CJP_CLASS_NUMBER            9U      // "-", "0" - "9"
+#define CJP_CLASS_TRUE              10U     // "t", "T"
+#define CJP_CLASS_FALSE             11U     // "f", "F"
+#define CJP_CLASS_NULL              12U     // "n", "N"
+#define CJP_CLASS_COUNT             13U
+
+#pragma endregion
+
 
 
 //   ---   Macros   ---
@@ -58,13 +80,60 @@
 #pragma region StringBuilder Functon Prototypes
 
 /**
- * @brief   Function used to extract and format the contents of a string contained
+ * @brief   Function used to extract and format the contents of a string contained. Escape sequences (including \uXXXX and surrogate pairs) are decoded and the string's UTF-8 encoding is validated in the same pass.
+ * 
+ * @param   refStrPtr Pointer to the start location (opening quote) of the string that is to be extracted inside of the original string that is to be parsed. Pointer pointer is also used to skip that segment of the string by incrementing the original string pointer to the closing quote. Points to the offending character on error.
+ * @param   endPtr Pointer behind the last character of the original string.
+ * @param   outBuf Scratch buffer the extracted and formatted string is written to. The buffer is reset before use.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if the string isn't terminated. Returns cJSON_InvalidCharacterSequence_Error on invalid UTF-8, unknown escape sequences and unescaped control characters.
+ */
+cJSON_Result_t cJSON_Parser_StringBuilder(const char **refStrPtr, const char *endPtr, cJSON_SDB_t *outBuf);
+/**
+ * @brief   Function used to extract and format the contents of a string like cJSON_Parser_StringBuilder, with an upper bound on the extracted length. The bound is checked before characters are copied, so longer strings are never buffered.
  * 
- * @param   refStrPtr Pointer to the start location of the string that is to be extracted inside of the original string that is to be parsed. Pointer pointer is also used to skip that segment of the string by incrementing the original string pointer.
- * @param   outputStrPtr Pointer to a string pointer variable where the extracted and formatted string should be stored.
- * @return  char* Returns 
+ * @param   refStrPtr See cJSON_Parser_StringBuilder.
+ * @param   endPtr Pointer behind the last character of the original string.
+ * @param   outBuf Scratch buffer the extracted and formatted string is written to. The buffer is reset before use.
+ * @param   maxLength Maximum length of the extracted string in bytes.
+ * @return  cJSON_Result_t Returns cJSON_LimitExceeded_Error if the extracted string would be longer than maxLength. Can return any error of cJSON_Parser_StringBuilder.
  */
-cJSON_Result_t cJSON_Parser_StringBuilder(char **refStrPtr, char **outputStrPtr);
+cJSON_Result_t cJSON_Parser_BoundedStringBuilder(const char **refStrPtr, const char *endPtr, cJSON_SDB_t *outBuf, size_t maxLength);
+/**
+ * @brief   Function used to parse a \uXXXX escape sequence. A high surrogate needs to be followed by a \uXXXX low surrogate, both are combined into one code point.
+ * 
+ * @param   refStrPtr Pointer to the location of the 'u' character of the escape sequence. Is incremented to the last hex digit of the escape sequence.
+ * @param   endPtr Pointer behind the last character of the original string.
+ * @param   codePoint Pointer to a variable the decoded code point is stored in.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_InvalidCharacterSequence_Error on malformed hex digits or unpaired surrogates.
+ */
+cJSON_Result_t cJSON_Parser_ParseUnicodeEscape(const char **refStrPtr, const char *endPtr, uint32_t *codePoint);
+/**
+ * @brief   Function used to encode a code point as UTF-8.
+ * 
+ * @param   codePoint Code point (up to U+10FFFF).
+ * @param   outSeq Buffer of at least 4 characters the UTF-8 sequence is written to.
+ * @return  size_t Length of the UTF-8 sequence in bytes.
+ */
+size_t cJSON_Parser_EncodeUTF8(uint32_t codePoint, char *outSeq);
+/**
+ * @brief   Function used to skip a string without extracting it. Escape sequences and the UTF-8 encoding are validated the same way cJSON_Parser_StringBuilder does.
+ * 
+ * @param   refStrPtr Pointer to the start location (opening quote) of the string. Is incremented to the closing quote, points to the offending character on error.
+ * @param   endPtr Pointer behind the last character of the original string.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if the string isn't terminated. Returns cJSON_InvalidCharacterSequence_Error on invalid UTF-8, unknown escape sequences and unescaped control characters.
+ */
+cJSON_Result_t cJSON_Parser_SkipString(const char **refStrPtr, const char *endPtr);
+/**
+ * @brief   Function used to match a lower case literal (true, false, null) case insensitively, like the parser does.
+ * 
+ * @param   str Start of the literal in the original string.
+ * @param   endPtr Pointer behind the last character of the original string.
+ * @param   literal Lower case literal.
+ * @param   literalLen Length of the literal.
+ * @return  true if the literal matches.
+ * @return  false if it does not match or the string ends early.
+ */
+bool cJSON_Parser_MatchLiteral(const char *str, const char *endPtr, const char *literal, size_t literalLen);
 
 #pragma endregion
 
@@ -74,10 +143,74 @@ cJSON_Result_t cJSON_Parser_StringBuilder(char **refStrPtr, char **outputStrPtr)
 /**
  * @brief   Function used to extract a number from the current location of the refStrPtr
  * 
- * @param   refStrPtr Pointer to the start location of the number that is to be extracted inside of the original string that is to be parsed. Pointer pointer is also used to skip that segment of the string by incrementing the original string pointer.
- * @return  cJSON_Generic_t Generic object containing the parsed integer or float.
+ * @param   refStrPtr Pointer to the start location of the number that is to be extracted inside of the original string that is to be parsed. Pointer pointer is also used to skip that segment of the string by incrementing the original string pointer to the number's last character.
+ * @param   endPtr Pointer behind the last character of the original string.
+ * @param   numBuffer Scratch buffer of at least CJSON_MAX_NUM_LEN + 1 characters.
+ * @param   arena Arena the number's data container is allocated from. NULL selects the heap.
+ * @param   numObj Pointer to a generic object the parsed integer or float is stored in.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_InvalidCharacterSequence_Error if the number is malformed or longer than CJSON_MAX_NUM_LEN.
+ */
+cJSON_Result_t cJSON_Parser_NumParser(const char **refStrPtr, const char *endPtr, char *numBuffer, cJSON_Arena_t *arena, cJSON_Generic_t *numObj);
+/**
+ * @brief   Function used to extract a number from the current location of the refStrPtr without allocating a generic object for it. Same string handling as cJSON_Parser_NumParser.
+ * 
+ * @param   refStrPtr Pointer to the start location of the number, incremented to the number's last character.
+ * @param   endPtr Pointer behind the last character of the original string.
+ * @param   numBuffer Scratch buffer of at least CJSON_MAX_NUM_LEN + 1 characters.
+ * @param   isFloat Pointer to a variable that is set to true if the number is a float and to false if it is an integer.
+ * @param   intVal Pointer to a variable the integer is stored in, if the number is an integer.
+ * @param   floatVal Pointer to a variable the float is stored in, if the number is a float.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_InvalidCharacterSequence_Error if the number is malformed or longer than CJSON_MAX_NUM_LEN.
+ */
+cJSON_Result_t cJSON_Parser_NumValue(const char **refStrPtr, const char *endPtr, char *numBuffer, bool *isFloat, cJSON_Int_t *intVal, cJSON_Float_t *floatVal);
+/**
+ * @brief   Function used to match a JSON number (-?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?) at the location of ptr.
+ * 
+ * @param   ptr Start of the number.
+ * @param   endPtr Pointer behind the last character of the original string.
+ * @param   isFloat Pointer to a variable that is set to true if the number has a fraction or an exponent. May be NULL.
+ * @return  size_t Length of the number in characters, 0 if ptr does not point to a valid number.
+ */
+size_t cJSON_Parser_ScanNumber(const char *ptr, const char *endPtr, bool *isFloat);
+
+#pragma endregion
+
+// - Parser Core Function Prototypes -
+#pragma region Parser Core Function Prototypes
+
+/**
+ * @brief   Parser core. Continues parsing the structure in GObjPtr with the range between *strPtr and endPtr, the parser state (object stack and flags) is kept in ctx between calls. Before the first call the state has to be reset (empty object stack, parserFlags 0, GObjPtr set to null).
+ * 
+ * @param   ctx Parse context.
+ * @param   GObjPtr cJSON_Generic pointer, where the parsed structure is saved in.
+ * @param   strPtr Pointer to the string pointer. Points to the closing character of the root structure if it was completed, to endPtr otherwise.
+ * @param   endPtr Pointer behind the last character of the range. The range must not end inside a token.
+ * @return  cJSON_Result_t Returns cJSON_Ok if the range was parsed without error (see cJSON_Parser_IsComplete). Can return one of the following errors: cJSON_DepthOutOfRange_Error, cJSON_Structure_Error, cJSON_InvalidCharacterSequence_Error, cJSON_NotAllocated_Error.
+ */
+cJSON_Result_t cJSON_Parser_Resume(cJSON_ParseContext_t *ctx, cJSON_Generic_t *GObjPtr, const char **strPtr, const char *endPtr);
+/**
+ * @brief   Function used to check if the root structure parsed by cJSON_Parser_Resume has been closed.
+ * 
+ * @param   ctx Parse context.
+ * @param   GObj Root structure.
+ * @return  true if the root structure is complete.
+ */
+bool cJSON_Parser_IsComplete(const cJSON_ParseContext_t *ctx, cJSON_Generic_t GObj);
+
+#pragma endregion
+
+// - Value Skipper Function Prototypes -
+#pragma region Value Skipper Function Prototypes
+
+/**
+ * @brief   Function used to skip a complete value (string, number, literal or container including its children) without building it. The skipped data is validated the same way the parser validates it.
+ * 
+ * @param   refStrPtr Pointer to the first character of the value. Is incremented to the value's last character, points to the offending character on error.
+ * @param   endPtr Pointer behind the last character of the original string.
+ * @param   depth Depth of the value, used to enforce CJSON_MAX_DEPTH.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Can return one of the following errors: cJSON_DepthOutOfRange_Error, cJSON_Structure_Error, cJSON_InvalidCharacterSequence_Error.
  */
-cJSON_Generic_t cJSON_Parser_NumParser(char **refStrPtr);
+cJSON_Result_t cJSON_Parser_SkipValue(const char **refStrPtr, const char *endPtr, size_t depth);
 
 #pragma endregion
 
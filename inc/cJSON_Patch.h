@@ -0,0 +1,42 @@
+/**
+ * @file cJSON_Patch.h
+ * @author HeCoding180
+ * @brief cJSON library patch header file. Contains JSON Patch (RFC 6902) diff and apply functions.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_PATCH_DEFINED
+#define CJSON_PATCH_DEFINED
+
+#include "cJSON_Types.h"
+
+//   ---   Function Prototypes   ---
+
+// - Patch Functions -
+#pragma region Patch Functions
+
+/**
+ * @brief   Function used to compute a JSON Patch (RFC 6902) that transforms oldObj into newObj.
+ *          Identical list prefixes and suffixes are skipped using item hashes, dictionary keys are matched using a temporary hash index for large dictionaries.
+ *
+ * @param   oldObj Source structure.
+ * @param   newObj Target structure.
+ * @param   patch Pointer to a cJSON_Generic_t variable the patch is stored in. The patch is a heap allocated list of operation dictionaries ("op", "path" and "value") and needs to be deleted using cJSON_delGenObj. Left unchanged on error.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_NotAllocated_Error if memory for the patch could not be allocated.
+ */
+cJSON_Result_t cJSON_diff(cJSON_Generic_t oldObj, cJSON_Generic_t newObj, cJSON_Generic_t *patch);
+/**
+ * @brief   Function used to apply a JSON Patch (RFC 6902) to a heap allocated structure in place. Supports the operations add, remove, replace, move, copy and test.
+ *          Operations are applied in order, operations preceding a failed operation stay applied. Values are copied from the patch, the patch itself is not modified.
+ *
+ * @param   GObjPtr Pointer to the structure that is to be patched. Is updated if the root itself is replaced.
+ * @param   patch List of operation dictionaries.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Can return one of the following errors: cJSON_Datatype_Error (malformed patch), cJSON_Structure_Error (malformed path), cJSON_NotFound_Error (path does not exist), cJSON_TestFailed_Error (test operation failed), cJSON_NotAllocated_Error (value could not be copied).
+ */
+cJSON_Result_t cJSON_applyPatch(cJSON_Generic_t *GObjPtr, cJSON_Generic_t patch);
+
+#pragma endregion
+
+#endif // CJSON_PATCH_DEFINED
@@ -0,0 +1,85 @@
+/**
+ * @file cJSON_Scanner.h
+ * @author HeCoding180
+ * @brief cJSON library scanner header file. Contains vectorized (SSE2/SSSE3 if available) scanning primitives used by the parser, the validator and other tools working on raw JSON text.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_SCANNER_DEFINED
+#define CJSON_SCANNER_DEFINED
+
+#include <stddef.h>
+
+#include "cJSON_Types.h"
+
+//   ---   Macros   ---
+
+// - Character Class Macros -
+#pragma region Character Class Macros
+
+/**
+ * @brief   Evaluates to true if c is a JSON whitespace character (space, tab, newline or carriage return).
+ *
+ */
+#define SCAN_IS_WHITESPACE(c) (((c) == ' ') || ((c) == '\t') || ((c) == '\n') || ((c) == '\r'))
+
+#pragma endregion
+
+
+
+//   ---   Function Prototypes   ---
+
+// - Scanner Functions -
+#pragma region Scanner Functions
+
+/**
+ * @brief   Function used to skip JSON whitespace.
+ *
+ * @param   ptr Start of the range.
+ * @param   endPtr Pointer behind the last character of the range.
+ * @return  const char* Pointer to the first non-whitespace character, endPtr if the range only contains whitespace.
+ */
+const char* SCAN_SkipWhitespace(const char *ptr, const char *endPtr);
+/**
+ * @brief   Function used to skip the plain characters of a string's contents.
+ *
+ * @param   ptr Start of the range (first character after the opening quote or after an escape sequence).
+ * @param   endPtr Pointer behind the last character of the range.
+ * @return  const char* Pointer to the first quote, backslash or control character (< 0x20), endPtr if none was found.
+ */
+const char* SCAN_StringRun(const char *ptr, const char *endPtr);
+/**
+ * @brief   Function used to remove insignificant whitespace (whitespace outside of strings) from a range in place. The string state is carried across calls, so a document can be minified in consecutive chunks.
+ *
+ * @param   buf Start of the range, the minified characters are written to its beginning.
+ * @param   len Length of the range in bytes.
+ * @param   inString Pointer to the string state, true if the range starts inside a string. Updated to the state at the end of the range.
+ * @param   escape Pointer to the escape state, true if the range starts behind a string's backslash. Updated to the state at the end of the range.
+ * @return  size_t Length of the minified range in bytes.
+ */
+size_t SCAN_Minify(char *buf, size_t len, bool *inString, bool *escape);
+
+/**
+ * @brief   Function used to validate that a range of bytes is well formed UTF-8 (no overlong encodings, no surrogates, no code points above U+10FFFF).
+ *
+ * @param   ptr Start of the range.
+ * @param   len Length of the range in bytes.
+ * @param   errOffset Pointer to a variable the offset of the first invalid byte is stored in if the range is invalid. May be NULL.
+ * @return  true if the range is valid UTF-8.
+ * @return  false if the range contains invalid UTF-8.
+ */
+bool SCAN_ValidateUTF8(const char *ptr, size_t len, size_t *errOffset);
+/**
+ * @brief   Function used to get the length of a single well formed UTF-8 sequence.
+ *
+ * @param   ptr Start of the sequence.
+ * @param   endPtr Pointer behind the last character of the range.
+ * @return  size_t Length of the sequence in bytes (1-4), 0 if the sequence is not well formed.
+ */
+size_t SCAN_UTF8SequenceLength(const char *ptr, const char *endPtr);
+
+#pragma endregion
+
+#endif // CJSON_SCANNER_DEFINED
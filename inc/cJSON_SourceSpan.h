@@ -0,0 +1,186 @@
+/**
+ * @file cJSON_SourceSpan.h
+ * @author HeCoding180
+ * @brief cJSON library source span header file. Contains the table of container source spans recorded during parsing, used for incremental reparsing (see cJSON_reparse).
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_SOURCE_SPAN_DEFINED
+#define CJSON_SOURCE_SPAN_DEFINED
+
+#include <stddef.h>
+
+#include "cJSON_Types.h"
+
+//   ---   Defines   ---
+
+/**
+ * @brief   Parent index of the root span.
+ *
+ */
+#define CJSON_SPAN_NO_PARENT            SIZE_MAX
+
+//   ---   Typedefs   ---
+
+// - Struct Typedefs -
+#pragma region Struct Typedefs
+
+/**
+ * @brief   Source span of a single container.
+ *
+ */
+typedef struct cJSON_SourceSpan
+{
+    /**
+     * @brief   Container the span belongs to.
+     *
+     */
+    cJSON_Generic_t obj;
+    /**
+     * @brief   Offset of the container's opening bracket.
+     *
+     */
+    size_t start;
+    /**
+     * @brief   Offset behind the container's closing bracket.
+     *
+     */
+    size_t end;
+    /**
+     * @brief   Index of the enclosing container's span, CJSON_SPAN_NO_PARENT for the root.
+     *
+     */
+    size_t parent;
+    /**
+     * @brief   Number of spans of the container's subtree, including its own.
+     *
+     */
+    size_t subtreeLength;
+} cJSON_SourceSpan_t;
+
+/**
+ * @brief   Spans of all containers of a document in document order (pre-order), so the spans of a container's subtree are stored consecutively.
+ *
+ */
+typedef struct cJSON_SpanTable
+{
+    cJSON_SourceSpan_t *spans;
+    size_t length;
+    size_t capacity;
+    /**
+     * @brief   Span of the innermost container that is still open while parsing, CJSON_SPAN_NO_PARENT if none.
+     *
+     */
+    size_t openSpan;
+} cJSON_SpanTable_t;
+
+/**
+ * @brief   Heap allocated document together with the source spans of its containers. Created using cJSON_parseWithSpans, updated using cJSON_reparse and deleted using cJSON_deleteSpanDoc.
+ *
+ */
+typedef struct cJSON_SpanDoc
+{
+    cJSON_Generic_t root;
+    cJSON_SpanTable_t spans;
+} cJSON_SpanDoc_t;
+
+/**
+ * @brief   Document parsed from a buffer of concatenated documents (see cJSON_parseMany), together with its byte range in the buffer.
+ *
+ */
+typedef struct cJSON_DocSpan
+{
+    cJSON_Generic_t root;
+    /**
+     * @brief   Offset of the document's opening bracket.
+     *
+     */
+    size_t start;
+    /**
+     * @brief   Offset behind the document's closing bracket.
+     *
+     */
+    size_t end;
+} cJSON_DocSpan_t;
+
+/**
+ * @brief   Describes a text edit: oldLength bytes at offset were replaced by newLength bytes.
+ *
+ */
+typedef struct cJSON_Edit
+{
+    size_t offset;
+    size_t oldLength;
+    size_t newLength;
+} cJSON_Edit_t;
+
+#pragma endregion
+
+
+
+//   ---   Function Prototypes   ---
+
+// - Span Table Functions -
+#pragma region Span Table Functions
+
+/**
+ * @brief   Function used to create an empty span table. Memory is allocated on the first push.
+ *
+ * @return  cJSON_SpanTable_t Empty span table.
+ */
+cJSON_SpanTable_t SPAN_Create(void);
+/**
+ * @brief   Function used to free the memory of a span table.
+ *
+ * @param   table Pointer to a span table.
+ */
+void SPAN_Delete(cJSON_SpanTable_t *table);
+/**
+ * @brief   Function used to remove all spans from a table while keeping its memory for reuse.
+ *
+ * @param   table Pointer to a span table.
+ */
+void SPAN_Clear(cJSON_SpanTable_t *table);
+
+/**
+ * @brief   Function used to record the opening bracket of a container. The new span becomes the open span.
+ *
+ * @param   table Pointer to a span table.
+ * @param   obj Container.
+ * @param   start Offset of the opening bracket.
+ * @return  true if the span was recorded, false if the table could not grow.
+ */
+bool SPAN_Open(cJSON_SpanTable_t *table, cJSON_Generic_t obj, size_t start);
+/**
+ * @brief   Function used to record the closing bracket of the open span's container. The enclosing span becomes the open span.
+ *
+ * @param   table Pointer to a span table.
+ * @param   end Offset behind the closing bracket.
+ */
+void SPAN_Close(cJSON_SpanTable_t *table, size_t end);
+
+/**
+ * @brief   Function used to find the innermost container whose brackets enclose a byte range, so that the range only touches the container's contents.
+ *
+ * @param   table Pointer to a span table.
+ * @param   offset Offset of the range.
+ * @param   length Length of the range.
+ * @return  size_t Index of the container's span. CJSON_SPAN_NO_PARENT if not even the root encloses the range.
+ */
+size_t SPAN_FindEnclosing(const cJSON_SpanTable_t *table, size_t offset, size_t length);
+/**
+ * @brief   Function used to replace the subtree spans of a container with the spans of a reparsed container. Spans behind the container are moved by delta bytes, enclosing spans grow by delta bytes.
+ *
+ * @param   table Pointer to a span table.
+ * @param   index Index of the replaced container's span.
+ * @param   sub Spans of the reparsed container, relative to its opening bracket.
+ * @param   delta Change of the container's length in bytes.
+ * @return  true if the spans were replaced, false if the table could not grow (table unchanged).
+ */
+bool SPAN_Splice(cJSON_SpanTable_t *table, size_t index, const cJSON_SpanTable_t *sub, ptrdiff_t delta);
+
+#pragma endregion
+
+#endif // CJSON_SOURCE_SPAN_DEFINED
@@ -0,0 +1,204 @@
+/**
+ * @file cJSON_Stats.h
+ * @author HeCoding180
+ * @brief cJSON library stats header file. Contains the optional per-thread parser instrumentation, compiled in if CJSON_ENABLE_STATS is defined (e.g. -DCJSON_ENABLE_STATS). Without it, the instrumentation macros expand to nothing and cJSON_getStats reports zeros.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_STATS_DEFINED
+#define CJSON_STATS_DEFINED
+
+#include <stdint.h>
+
+#include "cJSON_Types.h"
+
+#ifdef CJSON_ENABLE_STATS
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(__aarch64__)
+#include <time.h>
+#endif
+#endif
+
+//   ---   Defines   ---
+
+#ifndef CJSON_STATS_SAMPLE_RATE
+/**
+ * @brief   One out of this many calls of a phase is timed (power of two), reading the counter on every call would cost more than most strings and numbers take to parse. Define as 1U to time every call.
+ *
+ */
+#define CJSON_STATS_SAMPLE_RATE         64U
+#endif
+
+/**
+ * @brief   Number of timed parser phases (see cJSON_StatsPhase_t).
+ *
+ */
+#define CJSON_STATS_PHASES              3U
+
+/**
+ * @brief   Number of token types counted, the token counts are indexed by cJSON_ContainerType_t (NullType to Boolean).
+ *
+ */
+#define CJSON_STATS_TOKEN_TYPES         ((unsigned)Boolean + 1U)
+
+//   ---   Typedefs   ---
+
+// - Enum Typedefs -
+#pragma region Enum Typedefs
+
+typedef enum cJSON_StatsPhase
+{
+    cJSON_ParsePhase,       // cJSON_Parser_Resume, used by all parse functions. Includes the other phases.
+    cJSON_StringPhase,      // cJSON_Parser_StringBuilder (keys and string values)
+    cJSON_NumberPhase       // cJSON_Parser_NumParser / cJSON_Parser_NumValue
+} cJSON_StatsPhase_t;
+
+#pragma endregion
+
+// - Struct Typedefs -
+#pragma region Struct Typedefs
+
+/**
+ * @brief   Parser statistics of a thread. Counters accumulate until cJSON_resetStats is called.
+ *
+ */
+typedef struct cJSON_Stats
+{
+    /**
+     * @brief   Time spent per phase in counter ticks (time stamp counter on x86, virtual counter on AArch64, nanoseconds elsewhere), indexed by cJSON_StatsPhase_t. Extrapolated from the sampled calls by cJSON_getStats.
+     *
+     */
+    uint64_t cycles[CJSON_STATS_PHASES];
+    /**
+     * @brief   Number of calls per phase, indexed by cJSON_StatsPhase_t.
+     *
+     */
+    uint64_t calls[CJSON_STATS_PHASES];
+    /**
+     * @brief   Number of timed calls per phase (see CJSON_STATS_SAMPLE_RATE), indexed by cJSON_StatsPhase_t.
+     *
+     */
+    uint64_t sampledCalls[CJSON_STATS_PHASES];
+    /**
+     * @brief   Number of parsed values per type, indexed by cJSON_ContainerType_t. Numbers stored in packed arrays count as Integer or Float.
+     *
+     */
+    uint64_t tokens[CJSON_STATS_TOKEN_TYPES];
+    /**
+     * @brief   Number of parsed dictionary keys.
+     *
+     */
+    uint64_t keys;
+    /**
+     * @brief   Number of input bytes processed by the parser.
+     *
+     */
+    uint64_t bytes;
+    /**
+     * @brief   Number of allocations (cJSON_alloc) and reallocations (cJSON_realloc), heap and arena.
+     *
+     */
+    uint64_t allocs;
+    uint64_t reallocs;
+    /**
+     * @brief   Number of bytes requested by allocations and reallocations.
+     *
+     */
+    uint64_t allocBytes;
+    /**
+     * @brief   Number of items appended to dictionaries, lists and packed arrays.
+     *
+     */
+    uint64_t appends;
+} cJSON_Stats_t;
+
+#pragma endregion
+
+
+
+//   ---   Macros   ---
+
+// - Instrumentation Macros -
+#pragma region Instrumentation Macros
+
+#ifdef CJSON_ENABLE_STATS
+
+/**
+ * @brief   Stats of the calling thread. Only updated through the instrumentation macros, cycles holds the ticks of the sampled calls only.
+ *
+ */
+extern _Thread_local cJSON_Stats_t cJSON_threadStats;
+
+/**
+ * @brief   Reads the counter used for phase timing.
+ *
+ */
+static inline uint64_t cJSON_statsNow(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    __asm__ volatile ("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/**
+ * @brief   Counts a call of a phase and starts timing it if the call is sampled. The start time is stored in a local variable named var (0 if not sampled).
+ * @param   phase cJSON_StatsPhase_t.
+ * @param   var Name of the variable.
+ */
+#define CJSON_STATS_BEGIN(phase, var)   uint64_t var = ((cJSON_threadStats.calls[phase]++ & (CJSON_STATS_SAMPLE_RATE - 1U)) == 0) ? cJSON_statsNow() : 0
+/**
+ * @brief   Ends timing a phase started using CJSON_STATS_BEGIN.
+ * @param   phase cJSON_StatsPhase_t.
+ * @param   var Name of the variable holding the start time.
+ */
+#define CJSON_STATS_END(phase, var)     do { if ((var) != 0) { cJSON_threadStats.cycles[phase] += cJSON_statsNow() - (var); cJSON_threadStats.sampledCalls[phase]++; } } while (0)
+/**
+ * @brief   Adds n to a counter of the calling thread's stats.
+ * @param   member Member of cJSON_Stats_t (array members with index).
+ * @param   n Value to add.
+ */
+#define CJSON_STATS_ADD(member, n)      (cJSON_threadStats.member += (uint64_t)(n))
+
+#else
+
+#define CJSON_STATS_BEGIN(phase, var)
+#define CJSON_STATS_END(phase, var)     do { } while (0)
+#define CJSON_STATS_ADD(member, n)      ((void)sizeof(n))
+
+#endif
+
+#pragma endregion
+
+
+
+//   ---   Function Prototypes   ---
+
+// - Stats Functions -
+#pragma region Stats Functions
+
+/**
+ * @brief   Function used to read the calling thread's parser statistics. Reports zeros if the library was built without CJSON_ENABLE_STATS.
+ *
+ * @param   stats Pointer to a user variable, where the statistics are to be stored.
+ */
+void cJSON_getStats(cJSON_Stats_t *stats);
+/**
+ * @brief   Function used to reset the calling thread's parser statistics to zero.
+ *
+ */
+void cJSON_resetStats(void);
+
+#pragma endregion
+
+#endif // CJSON_STATS_DEFINED
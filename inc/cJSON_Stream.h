@@ -0,0 +1,130 @@
+/**
+ * @file cJSON_Stream.h
+ * @author HeCoding180
+ * @brief cJSON library stream header file. Contains the incremental (chunk fed) parser and the pipelined file parser built on it.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_STREAM_DEFINED
+#define CJSON_STREAM_DEFINED
+
+#include <stddef.h>
+
+#include "cJSON_ParseContext.h"
+#include "cJSON_StringDoubleBuffer.h"
+#include "cJSON_Types.h"
+
+//   ---   Typedefs   ---
+
+// - Struct Typedefs -
+#pragma region Struct Typedefs
+
+/**
+ * @brief   Incremental parser. Create it using cJSON_createIncParser, feed it chunks of arbitrary size using cJSON_incParserFeed and retrieve the structure using cJSON_incParserFinish.
+ *
+ */
+typedef struct cJSON_IncParser
+{
+    cJSON_ParseContext_t ctx;
+    /**
+     * @brief   Structure being parsed.
+     *
+     */
+    cJSON_Generic_t root;
+    /**
+     * @brief   Unparsed tail of the previous chunks (a token that continues in the next chunk).
+     *
+     */
+    cJSON_SDB_t carry;
+    /**
+     * @brief   Lexical state at the end of the data fed so far.
+     *
+     */
+    bool inString;
+    bool escape;
+    /**
+     * @brief   True once the root structure has been closed, further data is ignored.
+     *
+     */
+    bool done;
+    cJSON_Result_t error;
+} cJSON_IncParser_t;
+
+/**
+ * @brief   Options of cJSON_parseFilePipelined.
+ *
+ */
+typedef struct cJSON_PipelineOptions
+{
+    /**
+     * @brief   Size of a block in bytes. 0 selects CJSON_PIPELINE_BLOCK_SIZE.
+     *
+     */
+    size_t blockSize;
+    /**
+     * @brief   Number of blocks of the ring buffer. 0 selects CJSON_PIPELINE_RING_SIZE.
+     *
+     */
+    size_t ringSize;
+} cJSON_PipelineOptions_t;
+
+#pragma endregion
+
+
+
+//   ---   Function Prototypes   ---
+
+// - Incremental Parser Functions -
+#pragma region Incremental Parser Functions
+
+/**
+ * @brief   Function used to create an incremental parser. Parsed structures are heap allocated and owned by the caller.
+ *
+ * @return  cJSON_IncParser_t Incremental parser.
+ */
+cJSON_IncParser_t cJSON_createIncParser(void);
+/**
+ * @brief   Function used to free the memory of an incremental parser, including a structure that wasn't retrieved using cJSON_incParserFinish.
+ *
+ * @param   parser Pointer to the parser.
+ */
+void cJSON_deleteIncParser(cJSON_IncParser_t *parser);
+
+/**
+ * @brief   Function used to parse the next chunk of a document. Chunks may be split anywhere, only tokens continuing in the next chunk are copied.
+ *
+ * @param   parser Pointer to the parser.
+ * @param   chunk Pointer to the chunk (does not need to be null terminated). It is not referenced after the call.
+ * @param   len Length of the chunk in bytes.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. The first error is kept and returned by every following call. Can return one of the following errors: cJSON_DepthOutOfRange_Error, cJSON_Structure_Error, cJSON_InvalidCharacterSequence_Error, cJSON_NotAllocated_Error.
+ */
+cJSON_Result_t cJSON_incParserFeed(cJSON_IncParser_t *parser, const char *chunk, size_t len);
+/**
+ * @brief   Function used to end the input and retrieve the parsed structure.
+ *
+ * @param   parser Pointer to the parser.
+ * @param   GObjPtr cJSON_Generic pointer, where the parsed structure will be saved in. The structure is owned by the caller afterwards.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if the root structure wasn't closed, or the error of a previous cJSON_incParserFeed call.
+ */
+cJSON_Result_t cJSON_incParserFinish(cJSON_IncParser_t *parser, cJSON_Generic_t *GObjPtr);
+
+#pragma endregion
+
+// - Pipelined File Parser Functions -
+#pragma region Pipelined File Parser Functions
+
+/**
+ * @brief   Function used to parse a file while it is being read. A reader thread reads blocks using pread into a ring buffer, while the calling thread parses the filled blocks using an incremental parser. The reader waits for free blocks (backpressure), so memory use is bounded by the ring size instead of the file size.
+ *
+ * @param   fileName Path of the file.
+ * @param   GObjPtr cJSON_Generic pointer, where the parsed structure will be saved in.
+ * @param   opts Pipeline options. May be NULL (default block and ring size).
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_NotFound_Error if the file could not be opened, cJSON_Unknown_Error if it could not be read, cJSON_NotAllocated_Error if the ring buffer could not be allocated. Can return any error of cJSON_incParserFeed.
+ */
+cJSON_Result_t cJSON_parseFilePipelined(const char *fileName, cJSON_Generic_t *GObjPtr, const cJSON_PipelineOptions_t *opts);
+
+#pragma endregion
+
+#endif // CJSON_STREAM_DEFINED
@@ -4,26 +4,27 @@
  * @brief Header file of the cJSON string double buffer
  * @version 0.1.0
  * @date 2024-09-03
- * 
+ *
  */
 
 #ifndef CJSON_SDB_DEFINED
 #define CJSON_SDB_DEFINED
 
+#include <stddef.h>
+
 #include "cJSON_Constants.h"
 
 //   ---   Typedefs   ---
 
 /**
- * @brief   Two stage buffer used by the parser's StringBuilder. Used to minimize the use of memory reallocations (realloc).
+ * @brief   Growable character buffer used by the parser's StringBuilder. The capacity doubles on overflow and is kept by SDB_Reset, so a buffer that is reused for many strings stops reallocating once it has reached the size of the longest string.
  *
  */
 typedef struct cJSON_StringDoubleBuffer
 {
     char *buffer;
     size_t bufferSize;
-    char preBuffer[CJSON_PARSE_STRING_PB_SIZE];
-    uint8_t preBufferSize;
+    size_t bufferCapacity;
 } cJSON_SDB_t;
 
 
@@ -37,6 +38,21 @@ typedef struct cJSON_StringDoubleBuffer
  * @param   c Character that is to be added to the buffer
  */
 void SDB_AddChar(cJSON_SDB_t *SDb, const char c);
+/**
+ * @brief   Function used to add a sequence of characters to a double buffer.
+ *
+ * @param   SDb StringBuilder DoubleBuffer pointer of the buffer the chars are to be added to.
+ * @param   chars Pointer to the first character that is to be added to the buffer.
+ * @param   count Number of characters that are to be added to the buffer.
+ */
+void SDB_AddChars(cJSON_SDB_t *SDb, const char *chars, size_t count);
+/**
+ * @brief   Function used to get a null terminated view of the buffer's contents. The view stays valid until the buffer is modified, reset or freed.
+ *
+ * @param   SDb StringDoubleBuffer struct pointer.
+ * @return  const char* Null terminated buffer contents.
+ */
+const char* SDB_GetStr(cJSON_SDB_t *SDb);
 /**
  * @brief   Function used to get a string from a StringDoubleBuffer struct.
  *
@@ -44,6 +60,12 @@ void SDB_AddChar(cJSON_SDB_t *SDb, const char c);
  * @return  char* completely assembled string from the StringDoubleBuffer struct. Dynamically allocated pointer, needs to be freed before discard.
  */
 char* SDB_BuildString(cJSON_SDB_t SDb);
+/**
+ * @brief   Function used to discard the buffer's contents while keeping its allocated memory for reuse.
+ *
+ * @param   SDb StringDoubleBuffer struct pointer.
+ */
+void SDB_Reset(cJSON_SDB_t *SDb);
 /**
  * @brief   Function used to free potentially allocated memory in a StringDoubleBuffer struct.
  *
@@ -43,6 +43,11 @@
  * @param   obj cJSON_Generic_t.
  */
 #define AS_STRING(obj) ((cJSON_String_t)((obj).dataContainer))
+/**
+ * @brief   Returns the length of the string stored in obj in bytes, using the stored string size if known and strlen otherwise. Use with care!
+ * @param   obj cJSON_Generic_t.
+ */
+#define AS_STRING_LENGTH(obj) (((obj).strSize > 0) ? (size_t)((obj).strSize - 1) : strlen(AS_STRING(obj)))
 /**
  * @brief   Returns obj.dataContainer as a cJSON_Int_t pointer. Use with care!
  * @param   obj cJSON_Generic_t.
@@ -73,6 +78,27 @@
  * @param   obj cJSON_Generic_t.
  */
 #define AS_BOOL(obj) (*AS_BOOL_PTR(obj))
+/**
+ * @brief   Returns a pointer of type cJSON_IntArray_t, pointing to the dataContainer of obj. Use with care!
+ * @param   obj cJSON_Generic_t.
+ */
+#define AS_INT_ARRAY_PTR(obj) ((cJSON_IntArray_t*)((obj).dataContainer))
+/**
+ * @brief   Returns a pointer of type cJSON_FloatArray_t, pointing to the dataContainer of obj. Use with care!
+ * @param   obj cJSON_Generic_t.
+ */
+#define AS_FLOAT_ARRAY_PTR(obj) ((cJSON_FloatArray_t*)((obj).dataContainer))
+
+#pragma endregion
+
+// - Type Check Macros -
+#pragma region Type Check Macros
+
+/**
+ * @brief   Checks if a container type is a list, either a generic one or a packed numeric array.
+ * @param   type cJSON_ContainerType_t.
+ */
+#define IS_LIST_TYPE(type) (((type) == List) || ((type) == IntArray) || ((type) == FloatArray))
 
 #pragma endregion
 
@@ -136,7 +162,9 @@ typedef enum cJSON_DataType
     String,
     Integer,
     Float,
-    Boolean
+    Boolean,
+    IntArray,
+    FloatArray
 } cJSON_ContainerType_t;
 
 typedef enum cJSON_Result
@@ -147,6 +175,10 @@ typedef enum cJSON_Result
     cJSON_InvalidCharacterSequence_Error,
     cJSON_NotAllocated_Error,
     cJSON_Structure_Error,
+    cJSON_NotFound_Error,
+    cJSON_TestFailed_Error,
+    cJSON_LimitExceeded_Error,
+    cJSON_DuplicateKey_Error,
     cJSON_Unknown_Error
 } cJSON_Result_t;
 
@@ -162,6 +194,11 @@ typedef enum cJSON_Result
 typedef struct cJSON_Generic
 {
     cJSON_ContainerType_t type;
+    /**
+     * @brief   Size of a String object's data container in bytes (length + terminator), stored in the padding behind type. Strings may contain null characters (\u0000) if it is set. 0 if the size is unknown (e.g. a string assigned to dataContainer by the user), the length is determined using strlen then.
+     * 
+     */
+    uint32_t strSize;
     void *dataContainer;
 } cJSON_Generic_t;
 
@@ -172,15 +209,66 @@ typedef struct cJSON_Generic
 typedef struct cJSON_List
 {
     cJSON_object_size_size_t length;
+    cJSON_object_size_size_t capacity;
     cJSON_Generic_t *data;
+    /**
+     * @brief   Set if the list was allocated from an arena (arena parses, arena clones). Its memory can't be freed or reallocated, so the in-place mutation functions reject it.
+     * 
+     */
+    bool arenaOwned;
 } cJSON_List_t;
 
+/**
+ * @brief   cJSON data container for a packed list of integers (IntArray), values are stored contiguously instead of as generic objects.
+ * 
+ */
+typedef struct cJSON_IntArray
+{
+    cJSON_object_size_size_t length;
+    cJSON_object_size_size_t capacity;
+    cJSON_Int_t *data;
+} cJSON_IntArray_t;
+
+/**
+ * @brief   cJSON data container for a packed list of floats (FloatArray), values are stored contiguously instead of as generic objects.
+ * 
+ */
+typedef struct cJSON_FloatArray
+{
+    cJSON_object_size_size_t length;
+    cJSON_object_size_size_t capacity;
+    cJSON_Float_t *data;
+} cJSON_FloatArray_t;
+
 /**
  * @brief   cJSON dictionary key type.
  * 
  */
 typedef cJSON_String_t cJSON_Key_t;
 
+/**
+ * @brief   Entry of a dictionary's sorted key table. Entries are sorted by key (strcmp order) and packed, so a binary search only touches this array until the prefixes match.
+ * 
+ */
+typedef struct cJSON_SortedKey
+{
+    /**
+     * @brief   First 8 key bytes behind the dictionary's common key prefix as a big-endian integer (zero padded), compares like the bytes themselves.
+     * 
+     */
+    uint64_t prefix;
+    /**
+     * @brief   Key length behind the common key prefix in bytes.
+     * 
+     */
+    uint32_t length;
+    /**
+     * @brief   Index of the entry in keyData/valueData (permutation back to the original order).
+     * 
+     */
+    uint32_t index;
+} cJSON_SortedKey_t;
+
 /**
  * @brief   cJSON data container for a dictionary object.
  * 
@@ -188,10 +276,49 @@ typedef cJSON_String_t cJSON_Key_t;
 typedef struct cJSON_Dict
 {
     cJSON_object_size_size_t length;
+    cJSON_object_size_size_t capacity;
+    /**
+     * @brief   Key pointers, followed by capacity inline key slots of CJSON_KEY_INLINE_SIZE bytes and capacity key lengths (uint32_t) in the same allocation. Short keys point to their slot, longer keys are allocated separately.
+     * 
+     */
     cJSON_Key_t *keyData;
     cJSON_Generic_t *valueData;
+    /**
+     * @brief   Optional open addressing key hash index (slots store entry index + 1, 0 marks an empty slot), built by cJSON_freeze. NULL if the dictionary has no index.
+     * 
+     */
+    uint32_t *keyIndex;
+    uint32_t keyIndexMask;
+    /**
+     * @brief   Optional sorted key table (length entries), built by cJSON_freeze or by arena parses with sortKeys set. Entries keep their original order in keyData/valueData. NULL if the dictionary has no sorted key table.
+     * 
+     */
+    cJSON_SortedKey_t *sortedKeys;
+    /**
+     * @brief   Length of the prefix shared by all keys, skipped by the sorted key table's prefixes (keys like "field_1", "field_2" would otherwise all have the same prefix).
+     * 
+     */
+    uint32_t sortedKeysOffset;
+    /**
+     * @brief   Set if the dictionary was allocated from an arena (arena parses, arena clones). Its memory can't be freed or reallocated, so the in-place mutation functions reject it.
+     * 
+     */
+    bool arenaOwned;
 } cJSON_Dict_t;
 
+/**
+ * @brief   Options for cJSON_clone.
+ * 
+ */
+typedef struct cJSON_CloneOptions
+{
+    /**
+     * @brief   Arena the clone is allocated from. If set, the whole clone is placed in one contiguous block of the arena (must not be deleted using cJSON_delGenObj). If NULL, the clone is heap allocated and can be deleted using cJSON_delGenObj.
+     * 
+     */
+    struct cJSON_Arena *arena;
+} cJSON_CloneOptions_t;
+
 #pragma endregion
 
 #endif
@@ -13,6 +13,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "cJSON_Arena.h"
 #include "cJSON_Constants.h"
 
 //   ---   Macros   ---
@@ -55,12 +56,36 @@
 // - Memory Management Functions -
 #pragma region Memory Management Functions
 
+/**
+ * @brief   Function that allocates size bytes either from an arena or, if arena is NULL, from the heap (malloc).
+ * @param   arena Arena the memory is allocated from. NULL selects the heap.
+ * @param   size Number of bytes to allocate.
+ * @return  Pointer to the allocated memory.
+ */
+void* cJSON_alloc(cJSON_Arena_t *arena, size_t size);
+/**
+ * @brief   Function that resizes memory allocated by cJSON_alloc from the same arena or, if arena is NULL, from the heap (realloc).
+ * @param   arena Arena the memory was allocated from. NULL selects the heap.
+ * @param   ptr Pointer to the previous allocation (may be NULL).
+ * @param   oldSize Size of the previous allocation in bytes.
+ * @param   newSize Requested size in bytes.
+ * @return  Pointer to the resized memory.
+ */
+void* cJSON_realloc(cJSON_Arena_t *arena, void *ptr, size_t oldSize, size_t newSize);
+
 /**
  * @brief   Function that allocates the required memory for a cJSON_Generic_t object together with its specified data container specified in the containerType parameter.
  * @param   containerType Specifies the type of the object stored in the generic object.
  * @return  Returns the memory address of a newly allocated cJSON_Generic_t already containing the type and pointer to the object of the specified type.
  */
 cJSON_Generic_t mallocGenObj(cJSON_ContainerType_t containerType);
+/**
+ * @brief   Same as mallocGenObj, but the data container is allocated from an arena. Objects allocated from an arena must not be deleted using cJSON_delGenObj.
+ * @param   arena Arena the data container is allocated from. NULL selects the heap.
+ * @param   containerType Specifies the type of the object stored in the generic object.
+ * @return  Returns a cJSON_Generic_t already containing the type and pointer to the object of the specified type.
+ */
+cJSON_Generic_t allocGenObj(cJSON_Arena_t *arena, cJSON_ContainerType_t containerType);
 
 #pragma endregion
 
@@ -68,22 +93,186 @@ cJSON_Generic_t mallocGenObj(cJSON_ContainerType_t containerType);
 #pragma region Structural Functions
 
 /**
- * @brief   Function to append a generic object to a dictionary.
+ * @brief   Function to append a generic object to a dictionary. The key string is copied, the dictionary's arrays grow geometrically.
  * 
+ * @param   arena Arena the dictionary was allocated from. NULL selects the heap.
  * @param   dictPtr Pointer to the dictionary the generic object should be added to.
  * @param   key Key string.
+ * @param   keyLength Length of the key string in bytes.
  * @param   valObj Value cJSON generic object.
- * @return  cJSON_Result_t 
  */
-void cJSON_appendToDict(cJSON_Dict_t *dictPtr, const cJSON_Key_t key, cJSON_Generic_t valObj);
+void cJSON_appendToDict(cJSON_Arena_t *arena, cJSON_Dict_t *dictPtr, const char *key, size_t keyLength, cJSON_Generic_t valObj);
 /**
- * @brief   Function to append a generic object to a list.
+ * @brief   Function to append a generic object to a list. The list's array grows geometrically.
  * 
+ * @param   arena Arena the list was allocated from. NULL selects the heap.
  * @param   listPtr Pointer to the list the generic object should be added to.
- * @param   obj 
- * @return  cJSON_Result_t 
+ * @param   obj Value cJSON generic object.
+ */
+void cJSON_appendToList(cJSON_Arena_t *arena, cJSON_List_t *listPtr, cJSON_Generic_t obj);
+
+/**
+ * @brief   Function to insert a generic object into a dictionary at a given index. The key string is copied, entries at and behind index are moved back by one.
+ * 
+ * @param   arena Arena the dictionary was allocated from. NULL selects the heap.
+ * @param   dictPtr Pointer to the dictionary the generic object should be inserted into.
+ * @param   index Insert position (0 to length).
+ * @param   key Key string.
+ * @param   keyLength Length of the key string in bytes.
+ * @param   valObj Value cJSON generic object.
+ */
+void cJSON_insertIntoDict(cJSON_Arena_t *arena, cJSON_Dict_t *dictPtr, cJSON_object_size_size_t index, const char *key, size_t keyLength, cJSON_Generic_t valObj);
+/**
+ * @brief   Function to insert a generic object into a list at a given index. Items at and behind index are moved back by one.
+ * 
+ * @param   arena Arena the list was allocated from. NULL selects the heap.
+ * @param   listPtr Pointer to the list the generic object should be inserted into.
+ * @param   index Insert position (0 to length).
+ * @param   obj Value cJSON generic object.
+ */
+void cJSON_insertIntoList(cJSON_Arena_t *arena, cJSON_List_t *listPtr, cJSON_object_size_size_t index, cJSON_Generic_t obj);
+/**
+ * @brief   Function to detach the value at a given index from a dictionary. The entry's key string is freed and the arrays shrink once at most a quarter is used (heap allocated dictionaries only), the order of the remaining entries is kept.
+ * 
+ * @param   dictPtr Pointer to the dictionary.
+ * @param   index Index of the entry (needs to be in range).
+ * @return  cJSON_Generic_t Detached value, owned by the caller.
+ */
+cJSON_Generic_t cJSON_detachFromDict(cJSON_Dict_t *dictPtr, cJSON_object_size_size_t index);
+/**
+ * @brief   Function to detach the item at a given index from a list. The array shrinks once at most a quarter is used (heap allocated lists only), the order of the remaining items is kept.
+ * 
+ * @param   listPtr Pointer to the list.
+ * @param   index Index of the item (needs to be in range).
+ * @return  cJSON_Generic_t Detached item, owned by the caller.
+ */
+cJSON_Generic_t cJSON_detachFromList(cJSON_List_t *listPtr, cJSON_object_size_size_t index);
+/**
+ * @brief   Function to detach the value at a given index from a dictionary in O(1) by moving the last entry into its place. Same ownership rules as cJSON_detachFromDict, the entry order is not kept.
+ * 
+ * @param   dictPtr Pointer to the dictionary.
+ * @param   index Index of the entry (needs to be in range).
+ * @return  cJSON_Generic_t Detached value, owned by the caller.
+ */
+cJSON_Generic_t cJSON_swapDetachFromDict(cJSON_Dict_t *dictPtr, cJSON_object_size_size_t index);
+/**
+ * @brief   Function to detach the item at a given index from a list in O(1) by moving the last item into its place. The item order is not kept.
+ * 
+ * @param   listPtr Pointer to the list.
+ * @param   index Index of the item (needs to be in range).
+ * @return  cJSON_Generic_t Detached item, owned by the caller.
+ */
+cJSON_Generic_t cJSON_swapDetachFromList(cJSON_List_t *listPtr, cJSON_object_size_size_t index);
+
+/**
+ * @brief   Function to check if a dictionary key is stored in its inline key slot (see cJSON_Dict_t).
+ * 
+ * @param   dictPtr Pointer to the dictionary.
+ * @param   index Index of the entry (needs to be in range).
+ * @return  true if the key is stored inline.
+ * @return  false if the key is allocated separately.
+ */
+bool cJSON_isInlineKey(const cJSON_Dict_t *dictPtr, cJSON_object_size_size_t index);
+/**
+ * @brief   Function to free the key of a heap allocated dictionary entry. Inline keys are released together with the key array.
+ * 
+ * @param   dictPtr Pointer to the dictionary.
+ * @param   index Index of the entry (needs to be in range).
+ */
+void cJSON_freeDictKey(cJSON_Dict_t *dictPtr, cJSON_object_size_size_t index);
+/**
+ * @brief   Function to get the stored length of a dictionary key.
+ * 
+ * @param   dictPtr Pointer to the dictionary.
+ * @param   index Index of the entry (needs to be in range).
+ * @return  size_t Length of the key in bytes.
+ */
+size_t cJSON_getDictKeyLength(const cJSON_Dict_t *dictPtr, cJSON_object_size_size_t index);
+
+/**
+ * @brief   Function to build the key hash index of an arena backed dictionary (see cJSON_Dict_t). The index is dropped by any later mutation of the dictionary.
+ * 
+ * @param   arena Arena the dictionary was allocated from, the index is released together with it.
+ * @param   dictPtr Pointer to the dictionary.
+ */
+void cJSON_buildDictIndex(cJSON_Arena_t *arena, cJSON_Dict_t *dictPtr);
+/**
+ * @brief   Function to build the sorted key table of an arena backed dictionary (see cJSON_Dict_t). Needs no hash table memory, lookups use a binary search. The table is dropped by any later mutation of the dictionary.
+ * 
+ * @param   arena Arena the dictionary was allocated from, the table is released together with it.
+ * @param   dictPtr Pointer to the dictionary.
+ */
+void cJSON_buildDictSortedKeys(cJSON_Arena_t *arena, cJSON_Dict_t *dictPtr);
+
+/**
+ * @brief   Function to find the index of a key in a dictionary. Uses the dictionary's sorted key table or key hash index if it has one.
+ * 
+ * @param   dictPtr Pointer to the dictionary.
+ * @param   key Key string.
+ * @param   hintIndex Index that is checked first (e.g. the index of the key in a similar dictionary). Out of range hints are ignored.
+ * @param   index Pointer to a variable the key's index is stored in.
+ * @return  true if the key was found.
+ * @return  false if the dictionary does not contain the key.
+ */
+bool cJSON_findDictKey(const cJSON_Dict_t *dictPtr, const char *key, cJSON_object_size_size_t hintIndex, cJSON_object_size_size_t *index);
+/**
+ * @brief   Function to find the index of a key of known length in a dictionary (see cJSON_findDictKey). The key may contain null characters.
+ * 
+ * @param   dictPtr Pointer to the dictionary.
+ * @param   key Key string.
+ * @param   length Length of the key in bytes.
+ * @param   hintIndex Index that is checked first. Out of range hints are ignored.
+ * @param   index Pointer to a variable the key's index is stored in.
+ * @return  true if the key was found.
+ * @return  false if the dictionary does not contain the key.
+ */
+bool cJSON_findDictKeyView(const cJSON_Dict_t *dictPtr, const char *key, size_t length, cJSON_object_size_size_t hintIndex, cJSON_object_size_size_t *index);
+
+#pragma endregion
+
+// - Packed Array Functions -
+#pragma region Packed Array Functions
+
+/**
+ * @brief   Function to append an integer to a packed integer array. The array grows geometrically.
+ * 
+ * @param   arena Arena the array was allocated from. NULL selects the heap.
+ * @param   arrPtr Pointer to the array.
+ * @param   intVal Integer value.
+ */
+void cJSON_appendToIntArray(cJSON_Arena_t *arena, cJSON_IntArray_t *arrPtr, cJSON_Int_t intVal);
+/**
+ * @brief   Function to append a float to a packed float array. The array grows geometrically.
+ * 
+ * @param   arena Arena the array was allocated from. NULL selects the heap.
+ * @param   arrPtr Pointer to the array.
+ * @param   floatVal Float value.
+ */
+void cJSON_appendToFloatArray(cJSON_Arena_t *arena, cJSON_FloatArray_t *arrPtr, cJSON_Float_t floatVal);
+/**
+ * @brief   Function to convert a packed numeric array (IntArray or FloatArray) into a generic list holding one Integer or Float object per value. The packed container is freed (heap allocated arrays only).
+ * 
+ * @param   arena Arena the array was allocated from, the list is allocated from it too. NULL selects the heap.
+ * @param   arrObj Packed numeric array.
+ * @return  cJSON_Generic_t Generic list replacing arrObj.
+ */
+cJSON_Generic_t cJSON_unpackArray(cJSON_Arena_t *arena, cJSON_Generic_t arrObj);
+
+/**
+ * @brief   Function to get the length of a list of any kind (List, IntArray or FloatArray).
+ * 
+ * @param   listObj List object (IS_LIST_TYPE needs to be true).
+ * @return  cJSON_object_size_size_t Number of items.
+ */
+cJSON_object_size_size_t cJSON_getListLength(cJSON_Generic_t listObj);
+/**
+ * @brief   Function to get the item at a given index of a list of any kind (List, IntArray or FloatArray). Items of packed arrays are returned as Integer or Float objects pointing into the array, they must not be deleted and are only valid as long as the array isn't modified.
+ * 
+ * @param   listObj List object (IS_LIST_TYPE needs to be true).
+ * @param   index Index of the item (needs to be in range).
+ * @return  cJSON_Generic_t Item.
  */
-void cJSON_appendToList(cJSON_List_t *listPtr, cJSON_Generic_t obj);
+cJSON_Generic_t cJSON_getListItem(cJSON_Generic_t listObj, cJSON_object_size_size_t index);
 
 #pragma endregion
 
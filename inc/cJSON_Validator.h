@@ -0,0 +1,35 @@
+/**
+ * @file cJSON_Validator.h
+ * @author HeCoding180
+ * @brief cJSON library validator header file. Contains the allocation free validate-only parser.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_VALIDATOR_DEFINED
+#define CJSON_VALIDATOR_DEFINED
+
+#include <stddef.h>
+
+#include "cJSON_Types.h"
+
+//   ---   Function Prototypes   ---
+
+// - Validator Functions -
+#pragma region Validator Functions
+
+/**
+ * @brief   Function used to check if a string contains a well formed JSON structure without building it. Runs the same grammar as the parser, including string escapes, UTF-8 and number syntax, but does not allocate any memory.
+ *          Returns the same result as cJSON_parseStr for the same data: characters before the root structure are skipped and content after it is ignored.
+ *
+ * @param   ptr Pointer to the JSON data (does not need to be null terminated).
+ * @param   len Length of the JSON data in bytes.
+ * @param   errOffset Pointer to a variable the byte offset of the first offending character is stored in if the validation fails. May be NULL.
+ * @return  cJSON_Result_t Returns cJSON_Ok if the data is valid. Can return one of the following errors: cJSON_DepthOutOfRange_Error, cJSON_Structure_Error, cJSON_InvalidCharacterSequence_Error.
+ */
+cJSON_Result_t cJSON_validate(const char *ptr, size_t len, size_t *errOffset);
+
+#pragma endregion
+
+#endif // CJSON_VALIDATOR_DEFINED
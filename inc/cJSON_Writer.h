@@ -0,0 +1,232 @@
+/**
+ * @file cJSON_Writer.h
+ * @author HeCoding180
+ * @brief cJSON library writer header file. Contains the streaming writer used to produce JSON text directly, without building a generic object tree first.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#ifndef CJSON_WRITER_DEFINED
+#define CJSON_WRITER_DEFINED
+
+#include <stddef.h>
+
+#include "cJSON_Constants.h"
+#include "cJSON_StringDoubleBuffer.h"
+#include "cJSON_Types.h"
+
+//   ---   Typedefs   ---
+
+// - Function Pointer Typedefs -
+#pragma region Function Pointer Typedefs
+
+/**
+ * @brief   Output callback of a flushing writer.
+ *
+ * @param   userData User pointer passed to cJSON_createCallbackWriter.
+ * @param   data Pointer to the JSON text.
+ * @param   len Length of the JSON text in bytes.
+ * @return  true if all data was written, false on error.
+ */
+typedef bool (*cJSON_WriteCallback_t)(void *userData, const char *data, size_t len);
+
+#pragma endregion
+
+// - Struct Typedefs -
+#pragma region Struct Typedefs
+
+/**
+ * @brief   Streaming writer. Create it using one of the cJSON_create...Writer functions, emit a single root value using the cJSON_write... functions and delete it using cJSON_deleteWriter.
+ *          The first misuse (e.g. a value where a key is expected, unbalanced containers) or output error is kept in error and returned by every following call.
+ *
+ */
+typedef struct cJSON_Writer
+{
+    /**
+     * @brief   Output buffer. Holds the whole text for buffer writers, unflushed text for flushing writers.
+     *
+     */
+    cJSON_SDB_t buffer;
+    /**
+     * @brief   Output callback, NULL for buffer writers.
+     *
+     */
+    cJSON_WriteCallback_t callback;
+    void *userData;
+    /**
+     * @brief   State of the open containers, one byte of frame flags per container.
+     *
+     */
+    uint8_t stack[CJSON_WRITER_MAX_DEPTH];
+    size_t depth;
+    bool rootWritten;
+    cJSON_Result_t error;
+} cJSON_Writer_t;
+
+#pragma endregion
+
+
+
+//   ---   Function Prototypes   ---
+
+// - Writer Functions -
+#pragma region Writer Functions
+
+/**
+ * @brief   Function used to create a writer that writes into a growable buffer (see cJSON_writerGetStr).
+ *
+ * @return  cJSON_Writer_t Writer.
+ */
+cJSON_Writer_t cJSON_createWriter(void);
+/**
+ * @brief   Function used to create a writer that passes its output to a callback whenever CJSON_WRITER_FLUSH_SIZE bytes are buffered (and on cJSON_writerFlush / cJSON_writerFinish).
+ *
+ * @param   callback Output callback.
+ * @param   userData User pointer passed to the callback.
+ * @return  cJSON_Writer_t Writer.
+ */
+cJSON_Writer_t cJSON_createCallbackWriter(cJSON_WriteCallback_t callback, void *userData);
+/**
+ * @brief   Function used to create a writer that writes its output to a file descriptor whenever CJSON_WRITER_FLUSH_SIZE bytes are buffered (and on cJSON_writerFlush / cJSON_writerFinish).
+ *
+ * @param   fd File descriptor, not closed by the writer.
+ * @return  cJSON_Writer_t Writer.
+ */
+cJSON_Writer_t cJSON_createFdWriter(int fd);
+/**
+ * @brief   Function used to free the memory of a writer. Unflushed output is discarded.
+ *
+ * @param   writer Pointer to the writer.
+ */
+void cJSON_deleteWriter(cJSON_Writer_t *writer);
+
+/**
+ * @brief   Function used to open a dictionary.
+ *
+ * @param   writer Pointer to the writer.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if no value is possible at the current location, cJSON_DepthOutOfRange_Error if CJSON_WRITER_MAX_DEPTH containers are open already.
+ */
+cJSON_Result_t cJSON_writerBeginDict(cJSON_Writer_t *writer);
+/**
+ * @brief   Function used to close the innermost dictionary.
+ *
+ * @param   writer Pointer to the writer.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if the innermost container isn't a dictionary or a key is missing its value.
+ */
+cJSON_Result_t cJSON_writerEndDict(cJSON_Writer_t *writer);
+/**
+ * @brief   Function used to open a list.
+ *
+ * @param   writer Pointer to the writer.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if no value is possible at the current location, cJSON_DepthOutOfRange_Error if CJSON_WRITER_MAX_DEPTH containers are open already.
+ */
+cJSON_Result_t cJSON_writerBeginList(cJSON_Writer_t *writer);
+/**
+ * @brief   Function used to close the innermost list.
+ *
+ * @param   writer Pointer to the writer.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if the innermost container isn't a list.
+ */
+cJSON_Result_t cJSON_writerEndList(cJSON_Writer_t *writer);
+/**
+ * @brief   Function used to write the key of the next dictionary entry.
+ *
+ * @param   writer Pointer to the writer.
+ * @param   key Key string, escaped as needed.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if the innermost container isn't a dictionary or the previous key is missing its value.
+ */
+cJSON_Result_t cJSON_writerKey(cJSON_Writer_t *writer, const char *key);
+/**
+ * @brief   Function used to write a dictionary key of known length, which may contain null characters.
+ *
+ * @param   writer Pointer to the writer.
+ * @param   key Key string, escaped as needed.
+ * @param   length Length of the key in bytes.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if the innermost container isn't a dictionary or the previous key is missing its value.
+ */
+cJSON_Result_t cJSON_writerKeyView(cJSON_Writer_t *writer, const char *key, size_t length);
+
+/**
+ * @brief   Function used to write a string value.
+ *
+ * @param   writer Pointer to the writer.
+ * @param   str String, escaped as needed. NULL is written as null.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if no value is possible at the current location.
+ */
+cJSON_Result_t cJSON_writerString(cJSON_Writer_t *writer, const char *str);
+/**
+ * @brief   Function used to write a string value of known length, which may contain null characters.
+ *
+ * @param   writer Pointer to the writer.
+ * @param   str String, escaped as needed.
+ * @param   length Length of the string in bytes.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if no value is possible at the current location.
+ */
+cJSON_Result_t cJSON_writerStringView(cJSON_Writer_t *writer, const char *str, size_t length);
+/**
+ * @brief   Function used to write an integer value.
+ *
+ * @param   writer Pointer to the writer.
+ * @param   intVal Integer value.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if no value is possible at the current location.
+ */
+cJSON_Result_t cJSON_writerInt(cJSON_Writer_t *writer, cJSON_Int_t intVal);
+/**
+ * @brief   Function used to write a float value. Infinity and NaN have no JSON representation and are written as null.
+ *
+ * @param   writer Pointer to the writer.
+ * @param   floatVal Float value.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if no value is possible at the current location.
+ */
+cJSON_Result_t cJSON_writerFloat(cJSON_Writer_t *writer, cJSON_Float_t floatVal);
+/**
+ * @brief   Function used to write a boolean value.
+ *
+ * @param   writer Pointer to the writer.
+ * @param   boolVal Boolean value.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if no value is possible at the current location.
+ */
+cJSON_Result_t cJSON_writerBool(cJSON_Writer_t *writer, cJSON_Bool_t boolVal);
+/**
+ * @brief   Function used to write a null value.
+ *
+ * @param   writer Pointer to the writer.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if no value is possible at the current location.
+ */
+cJSON_Result_t cJSON_writerNull(cJSON_Writer_t *writer);
+/**
+ * @brief   Function used to write a generic object (and all of its children) as a value.
+ *
+ * @param   writer Pointer to the writer.
+ * @param   GObj cJSON_Generic_t object.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if no value is possible at the current location, cJSON_DepthOutOfRange_Error if the object nests too deep.
+ */
+cJSON_Result_t cJSON_writerValue(cJSON_Writer_t *writer, cJSON_Generic_t GObj);
+
+/**
+ * @brief   Function used to pass all buffered output to a flushing writer's output. Does nothing for buffer writers.
+ *
+ * @param   writer Pointer to the writer.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Unknown_Error if the output failed.
+ */
+cJSON_Result_t cJSON_writerFlush(cJSON_Writer_t *writer);
+/**
+ * @brief   Function used to check that a complete root value was written and to flush the remaining output.
+ *
+ * @param   writer Pointer to the writer.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if the root value is missing or incomplete, cJSON_Unknown_Error if the output failed.
+ */
+cJSON_Result_t cJSON_writerFinish(cJSON_Writer_t *writer);
+/**
+ * @brief   Function used to get the output of a buffer writer.
+ *
+ * @param   writer Pointer to the writer.
+ * @param   len Pointer to a variable the length of the output is stored in. May be NULL.
+ * @return  const char* Null terminated output. Stays valid until the writer is written to or deleted.
+ */
+const char* cJSON_writerGetStr(cJSON_Writer_t *writer, size_t *len);
+
+#pragma endregion
+
+#endif // CJSON_WRITER_DEFINED
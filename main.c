@@ -4,12 +4,14 @@
 
 // Include cJSON Library
 #include "inc/cJSON.h"
+#include "inc/cJSON_Patch.h"
 
 // - Testing Constant Variables -
 
 // - Testing Function Prototypes -
 cJSON_String_t readFileContents(const char* fileName);
 void printBtcValue(const char* JSONstr);
+void testPatchNullKeys(void);
 
 int main()
 {
@@ -22,6 +24,7 @@ int main()
     //printf("\"A\": Parse JSON file\n");
     printf("\"b\": Bitcoin value from coinbase API's JSON string\n");           //https://api.coinbase.com/v2/prices/spot?currency=USD
     //printf("\"B\": Bitcoin value from coinbase API's JSON string (file)\n");    //https://api.coinbase.com/v2/prices/spot?currency=USD
+    printf("\"p\": Patch round trip of keys containing null characters\n");
 
     // Get test type
     char testType = getchar();
@@ -48,6 +51,9 @@ int main()
     case 'B':
         printf("Test not implemented!\n");
         break;
+    case 'p':
+        testPatchNullKeys();
+        break;
     default:
         printf("Invalid test type \"%c\"\n", testType);
         break;
@@ -167,3 +173,38 @@ void printBtcValue(const char* JSONstr)
 
     cJSON_delGenObj(Base_cJSON_Tree);
 }
+
+void testPatchNullKeys(void)
+{
+    // Keys only differing behind a null character
+    const char *oldStr = "{\"a\\u0000b\": 1, \"nested\\u0000\": {\"~/\\u0000\": [1, 2]}}";
+    const char *newStr = "{\"a\\u0000c\": 1, \"nested\\u0000\": {\"~/\\u0000\": [1, 3]}}";
+
+    cJSON_Generic_t oldObj = {0}, newObj = {0}, patch = {0};
+
+    if ((cJSON_parseStr(&oldObj, oldStr) != cJSON_Ok) || (cJSON_parseStr(&newObj, newStr) != cJSON_Ok))
+    {
+        printf("Parse failed!\n");
+        return;
+    }
+
+    cJSON_Result_t funcResult = cJSON_diff(oldObj, newObj, &patch);
+    if (funcResult != cJSON_Ok)
+    {
+        printf("Diff failed with error code %d!\n", (int)funcResult);
+        return;
+    }
+
+    funcResult = cJSON_applyPatch(&oldObj, patch);
+    if (funcResult != cJSON_Ok)
+    {
+        printf("Apply failed with error code %d!\n", (int)funcResult);
+        return;
+    }
+
+    printf("Patch round trip %s\n", cJSON_equals(oldObj, newObj) ? "passed" : "failed");
+
+    cJSON_delGenObj(oldObj);
+    cJSON_delGenObj(newObj);
+    cJSON_delGenObj(patch);
+}
@@ -9,8 +9,958 @@
 
 #include "../inc/cJSON.h"
 #include "../inc/cJSON_Parser_Util.h"
+#include "../inc/cJSON_Scanner.h"
+#include "../inc/cJSON_Stats.h"
 #include "../inc/cJSON_Util.h"
 
+//   ---   Defines   ---
+
+/**
+ * @brief   Threads the parser loop using computed gotos (GCC and Clang): every token handler dispatches the next character on its own, instead of all characters going through one switch. Define CJSON_NO_COMPUTED_GOTO to use the switch.
+ * 
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(CJSON_NO_COMPUTED_GOTO)
+#define CJP_USE_COMPUTED_GOTO
+#endif
+
+// - Parser Dispatch Macros -
+#pragma region Parser Dispatch Macros
+
+#ifdef CJP_USE_COMPUTED_GOTO
+#define CJP_DISPATCH(charClass)     goto *dispatchTable[charClass];
+#define CJP_CASE(name)              CJP_LABEL_##name
+#define CJP_NEXT()                  do                                                                                  \
+                                    {                                                                                   \
+                                        if (++str >= endPtr) goto rangeEnd;                                             \
+                                        charClass = cJSON_Parser_CharClass[(uint8_t)*str];                              \
+                                        if (!(pFlags & cJSON_Parser_ClassFlags[charClass])) goto structureError;        \
+                                        goto *dispatchTable[charClass];                                                 \
+                                    } while (0)
+#else
+#define CJP_DISPATCH(charClass)     switch (charClass)
+#define CJP_CASE(name)              case CJP_CLASS_##name
+#define CJP_NEXT()                  goto nextChar
+#endif
+
+#pragma endregion
+
+
+
+//   ---   Constants   ---
+
+// - Parser Tables -
+#pragma region Parser Tables
+
+/**
+ * @brief   Character class (CJP_CLASS_*) of every byte. Literals are matched case insensitively, so upper case first characters share the class of their lower case counterparts.
+ * 
+ */
+static const uint8_t cJSON_Parser_CharClass[256] =
+{
+    [' ']  = CJP_CLASS_WHITESPACE,  ['\t'] = CJP_CLASS_WHITESPACE,  ['\n'] = CJP_CLASS_WHITESPACE,  ['\r'] = CJP_CLASS_WHITESPACE,
+    ['{']  = CJP_CLASS_DICT_START,  ['[']  = CJP_CLASS_LIST_START,
+    ['}']  = CJP_CLASS_DICT_END,    [']']  = CJP_CLASS_LIST_END,
+    [',']  = CJP_CLASS_ITEM_SEPT,   [':']  = CJP_CLASS_DICT_SEPT,
+    ['"']  = CJP_CLASS_STRING,
+    ['-']  = CJP_CLASS_NUMBER,
+    ['0']  = CJP_CLASS_NUMBER,      ['1']  = CJP_CLASS_NUMBER,      ['2']  = CJP_CLASS_NUMBER,      ['3']  = CJP_CLASS_NUMBER,      ['4']  = CJP_CLASS_NUMBER,
+    ['5']  = CJP_CLASS_NUMBER,      ['6']  = CJP_CLASS_NUMBER,      ['7']  = CJP_CLASS_NUMBER,      ['8']  = CJP_CLASS_NUMBER,      ['9']  = CJP_CLASS_NUMBER,
+    ['t']  = CJP_CLASS_TRUE,        ['T']  = CJP_CLASS_TRUE,
+    ['f']  = CJP_CLASS_FALSE,       ['F']  = CJP_CLASS_FALSE,
+    ['n']  = CJP_CLASS_NULL,        ['N']  = CJP_CLASS_NULL
+};
+
+/**
+ * @brief   Parser flags under which a character class is allowed, a token is valid if it shares at least one flag with the current parser flags. Invalid characters are never allowed, whitespace always.
+ * 
+ */
+static const uint8_t cJSON_Parser_ClassFlags[CJP_CLASS_COUNT] =
+{
+    [CJP_CLASS_INVALID]     = 0,
+    [CJP_CLASS_WHITESPACE]  = 0xFF,
+    [CJP_CLASS_DICT_START]  = CJP_DICT_VALUE_POSSIBLE | CJP_LIST_VALUE_POSSIBLE,
+    [CJP_CLASS_LIST_START]  = CJP_DICT_VALUE_POSSIBLE | CJP_LIST_VALUE_POSSIBLE,
+    [CJP_CLASS_DICT_END]    = CJP_DICT_END_POSSIBLE,
+    [CJP_CLASS_LIST_END]    = CJP_LIST_END_POSSIBLE,
+    [CJP_CLASS_ITEM_SEPT]   = CJP_ITEM_SEPT_POSSIBLE,
+    [CJP_CLASS_DICT_SEPT]   = CJP_DICT_SEPT_POSSIBLE,
+    [CJP_CLASS_STRING]      = CJP_DICT_KEY_POSSIBLE | CJP_DICT_VALUE_POSSIBLE | CJP_LIST_VALUE_POSSIBLE,
+    [CJP_CLASS_NUMBER]      = CJP_DICT_VALUE_POSSIBLE | CJP_LIST_VALUE_POSSIBLE,
+    // Literals are matched before their location is checked, so malformed literals are reported as such
+    [CJP_CLASS_TRUE]        = 0xFF,
+    [CJP_CLASS_FALSE]       = 0xFF,
+    [CJP_CLASS_NULL]        = 0xFF
+};
+
+#pragma endregion
+
+
+
+//   ---   Static Function Implementations   ---
+
+// - Parser Helper Functions -
+#pragma region Parser Helper Functions
+
+/**
+ * @brief   Charges parsed values and their memory against the context's limits. Called before the memory is allocated, so nothing has to be undone when a limit is exceeded.
+ * 
+ * @param   ctx Parse context.
+ * @param   nodes Number of parsed values.
+ * @param   bytes Memory needed for the values in bytes.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_LimitExceeded_Error if limits.maxNodes or limits.maxBytes is exceeded.
+ */
+static inline cJSON_Result_t cJSON_Parser_Charge(cJSON_ParseContext_t *ctx, size_t nodes, size_t bytes)
+{
+    ctx->nodeCount += nodes;
+    ctx->byteCount += bytes;
+
+    if ((ctx->limits.maxNodes != 0) && (ctx->nodeCount > ctx->limits.maxNodes)) return cJSON_LimitExceeded_Error;
+    if ((ctx->limits.maxBytes != 0) && (ctx->byteCount > ctx->limits.maxBytes)) return cJSON_LimitExceeded_Error;
+
+    return cJSON_Ok;
+}
+
+/**
+ * @brief   Returns the memory needed for a value of the given type in bytes: the container slot it occupies and its data container. Strings add their length on top.
+ * 
+ */
+static inline size_t cJSON_Parser_ValueCost(cJSON_ContainerType_t type)
+{
+    switch (type)
+    {
+    case Dictionary:    return sizeof(cJSON_Generic_t) + sizeof(cJSON_Dict_t);
+    case List:          return sizeof(cJSON_Generic_t) + sizeof(cJSON_List_t);
+    case Integer:       return sizeof(cJSON_Generic_t) + sizeof(cJSON_Int_t);
+    case Float:         return sizeof(cJSON_Generic_t) + sizeof(cJSON_Float_t);
+    case Boolean:       return sizeof(cJSON_Generic_t) + sizeof(cJSON_Bool_t);
+    default:            return sizeof(cJSON_Generic_t);
+    }
+}
+
+/**
+ * @brief   Returns the maximum length of the next string: limits.maxStringLength, further bounded by what is left of limits.maxBytes.
+ * 
+ */
+static inline size_t cJSON_Parser_StringBound(const cJSON_ParseContext_t *ctx)
+{
+    size_t bound = (ctx->limits.maxStringLength != 0) ? ctx->limits.maxStringLength : SIZE_MAX;
+
+    if ((ctx->limits.maxBytes != 0) && (ctx->limits.maxBytes - ctx->byteCount < bound)) bound = ctx->limits.maxBytes - ctx->byteCount;
+
+    return bound;
+}
+
+/**
+ * @brief   Replaces the container on top of the object stack. The reference held by the enclosing container (or the root object) is updated as well.
+ * 
+ * @param   ctx Parse context.
+ * @param   GObjPtr Pointer to the root object.
+ * @param   newObj Replacement container.
+ */
+static void cJSON_Parser_ReplaceTop(cJSON_ParseContext_t *ctx, cJSON_Generic_t *GObjPtr, cJSON_Generic_t newObj)
+{
+    GS_TOP(ctx->objectStack) = newObj;
+
+    if (ctx->objectStack.index == 0)
+    {
+        *GObjPtr = newObj;
+    }
+    else
+    {
+        // Open containers are always the last item of their parent
+        cJSON_Generic_t parent = ctx->objectStack.stack[ctx->objectStack.index - 1];
+
+        if (parent.type == Dictionary)  AS_DICT_PTR(parent)->valueData[AS_DICT_PTR(parent)->length - 1] = newObj;
+        else                            AS_LIST_PTR(parent)->data[AS_LIST_PTR(parent)->length - 1] = newObj;
+    }
+}
+
+/**
+ * @brief   Adds a parsed value to the container on top of the object stack and updates the parser flags accordingly.
+ * 
+ * @param   ctx Parse context.
+ * @param   GObjPtr Pointer to the root object.
+ * @param   pFlags Pointer to the parser flags.
+ * @param   valObj Parsed value.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_Structure_Error if no value is possible at the current location.
+ */
+static cJSON_Result_t cJSON_Parser_AddValue(cJSON_ParseContext_t *ctx, cJSON_Generic_t *GObjPtr, uint8_t *pFlags, cJSON_Generic_t valObj)
+{
+    CJSON_STATS_ADD(tokens[valObj.type], 1);
+
+    if (*pFlags & CJP_DICT_VALUE_POSSIBLE)
+    {
+        cJSON_appendToDict(cJSON_getParseContextArena(ctx), AS_DICT_PTR(GS_TOP(ctx->objectStack)), SDB_GetStr(&ctx->keyBuffer), ctx->keyBuffer.bufferSize, valObj);
+
+        *pFlags = CJP_DICT_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
+    }
+    else if (*pFlags & CJP_LIST_VALUE_POSSIBLE)
+    {
+        // Packed arrays only hold numbers of their own type, any other value turns them back into a generic list
+        if (GS_TOP(ctx->objectStack).type != List)
+        {
+            cJSON_Parser_ReplaceTop(ctx, GObjPtr, cJSON_unpackArray(cJSON_getParseContextArena(ctx), GS_TOP(ctx->objectStack)));
+        }
+
+        cJSON_appendToList(cJSON_getParseContextArena(ctx), AS_LIST_PTR(GS_TOP(ctx->objectStack)), valObj);
+
+        *pFlags = CJP_LIST_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
+    }
+    else
+    {
+        return cJSON_Structure_Error;
+    }
+
+    return cJSON_Ok;
+}
+
+/**
+ * @brief   Parses a number and adds it to the container on top of the object stack. If packNumbers is set, lists whose items are all integers or all floats are stored as IntArray or FloatArray.
+ * 
+ * @param   ctx Parse context.
+ * @param   GObjPtr Pointer to the root object.
+ * @param   pFlags Pointer to the parser flags.
+ * @param   strPtr Pointer to the string pointer, incremented to the number's last character.
+ * @param   endPtr Pointer behind the last character of the string.
+ * @return  cJSON_Result_t Returns cJSON_Ok by default. Returns cJSON_InvalidCharacterSequence_Error if the number is malformed.
+ */
+static cJSON_Result_t cJSON_Parser_AddNumber(cJSON_ParseContext_t *ctx, cJSON_Generic_t *GObjPtr, uint8_t *pFlags, const char **strPtr, const char *endPtr)
+{
+    cJSON_Arena_t *arena = cJSON_getParseContextArena(ctx);
+    cJSON_Generic_t top = GS_TOP(ctx->objectStack);
+    cJSON_Result_t result;
+
+    // Packing is decided by a list's first item, span tables reference the original list containers
+    bool packable = ctx->packNumbers && (ctx->spans == NULL) && (*pFlags & CJP_LIST_VALUE_POSSIBLE) && ((top.type != List) || (AS_LIST_PTR(top)->length == 0));
+
+    bool isFloat;
+    cJSON_Int_t intVal = 0;
+    cJSON_Float_t floatVal = 0;
+
+    // The value is parsed before allocating, so it can be charged against the limits first
+    result = cJSON_Parser_NumValue(strPtr, endPtr, ctx->numBuffer, &isFloat, &intVal, &floatVal);
+    if (result != cJSON_Ok) return result;
+
+    // Packed items only need the value itself, any other number a generic object
+    bool packed = packable && ((top.type == List) || ((top.type == IntArray) != isFloat));
+
+    result = cJSON_Parser_Charge(ctx, 1, packed ? (isFloat ? sizeof(cJSON_Float_t) : sizeof(cJSON_Int_t)) : cJSON_Parser_ValueCost(isFloat ? Float : Integer));
+    if (result != cJSON_Ok) return result;
+
+    if (!packable)
+    {
+        cJSON_Generic_t numObj = allocGenObj(arena, isFloat ? Float : Integer);
+
+        if (isFloat)    AS_FLOAT(numObj) = floatVal;
+        else            AS_INT(numObj) = intVal;
+
+        return cJSON_Parser_AddValue(ctx, GObjPtr, pFlags, numObj);
+    }
+
+    if (top.type == List)
+    {
+        // Replace the empty list by a packed array of the first item's type
+        if (!ctx->useArena) cJSON_delGenObj(top);
+
+        top = allocGenObj(arena, isFloat ? FloatArray : IntArray);
+        cJSON_Parser_ReplaceTop(ctx, GObjPtr, top);
+    }
+
+    if ((top.type == IntArray) && !isFloat)
+    {
+        cJSON_appendToIntArray(arena, AS_INT_ARRAY_PTR(top), intVal);
+    }
+    else if ((top.type == FloatArray) && isFloat)
+    {
+        cJSON_appendToFloatArray(arena, AS_FLOAT_ARRAY_PTR(top), floatVal);
+    }
+    else
+    {
+        // Mixed number types, the list is unpacked while adding the item
+        cJSON_Generic_t numObj = allocGenObj(arena, isFloat ? Float : Integer);
+
+        if (isFloat)    AS_FLOAT(numObj) = floatVal;
+        else            AS_INT(numObj) = intVal;
+
+        return cJSON_Parser_AddValue(ctx, GObjPtr, pFlags, numObj);
+    }
+
+    CJSON_STATS_ADD(tokens[isFloat ? Float : Integer], 1);
+    *pFlags = CJP_LIST_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
+
+    return cJSON_Ok;
+}
+
+/**
+ * @brief   Checks if the document starting at str is cut off, i.e. its root isn't closed before endPtr. Only tracks brackets and strings, so it is used on the error path of cJSON_parseMany only, to tell a cut off document from a malformed one.
+ * 
+ * @param   str Pointer to the opening bracket of the root.
+ * @param   endPtr Pointer behind the last character of the buffer.
+ * @return  true if the end of the buffer is reached before the root is closed.
+ */
+static bool cJSON_Parser_IsCutOff(const char *str, const char *endPtr)
+{
+    size_t depth = 0;
+
+    for (; str < endPtr; str++)
+    {
+        if ((*str == '{') || (*str == '['))
+        {
+            depth++;
+        }
+        else if ((*str == '}') || (*str == ']'))
+        {
+            if (--depth == 0) return false;
+        }
+        else if (*str == '"')
+        {
+            // Skip string, escaped characters can't end it
+            for (str++; (str < endPtr) && (*str != '"'); str++)
+            {
+                if ((*str == '\\') && (str + 1 < endPtr)) str++;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief   Updates the parser flags after a container has been closed.
+ * 
+ * @param   ctx Parse context.
+ * @return  uint8_t New parser flags. Zero if the root container has been closed.
+ */
+static uint8_t cJSON_Parser_FlagsAfterClose(cJSON_ParseContext_t *ctx)
+{
+    if (GS_IS_EMPTY(ctx->objectStack))
+    {
+        // Clear parser flags, stack is empty, parsing complete
+        return 0;
+    }
+    else if (GS_TOP(ctx->objectStack).type == Dictionary)
+    {
+        return CJP_DICT_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
+    }
+    else
+    {
+        return CJP_LIST_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
+    }
+}
+
+#pragma endregion
+
+// - Parser Core Functions -
+#pragma region Parser Core Functions
+
+/**
+ * @brief   Parser loop of cJSON_Parser_Resume. Every character is mapped to its class (cJSON_Parser_CharClass), a single lookup in cJSON_Parser_ClassFlags then checks the token against the current parser flags before it is dispatched to its handler.
+ * 
+ * @param   ctx Parse context.
+ * @param   GObjPtr Pointer to the root object.
+ * @param   strPtr Pointer to the string pointer, see cJSON_Parser_Resume.
+ * @param   endPtr Pointer behind the last character of the string.
+ * @return  cJSON_Result_t See cJSON_Parser_Resume.
+ */
+static cJSON_Result_t cJSON_Parser_Run(cJSON_ParseContext_t *ctx, cJSON_Generic_t *GObjPtr, const char **strPtr, const char *endPtr)
+{
+    cJSON_Arena_t *arena = cJSON_getParseContextArena(ctx);
+    const char *str = *strPtr;
+
+    cJSON_Result_t result = cJSON_Ok;
+    uint8_t pFlags = ctx->parserFlags;
+    uint8_t charClass;
+
+#ifdef CJP_USE_COMPUTED_GOTO
+    // Invalid characters never pass the flag check, their entry is never used
+    static void *const dispatchTable[CJP_CLASS_COUNT] =
+    {
+        [CJP_CLASS_INVALID]     = &&structureError,
+        [CJP_CLASS_WHITESPACE]  = &&CJP_LABEL_WHITESPACE,
+        [CJP_CLASS_DICT_START]  = &&CJP_LABEL_DICT_START,
+        [CJP_CLASS_LIST_START]  = &&CJP_LABEL_LIST_START,
+        [CJP_CLASS_DICT_END]    = &&CJP_LABEL_DICT_END,
+        [CJP_CLASS_LIST_END]    = &&CJP_LABEL_LIST_END,
+        [CJP_CLASS_ITEM_SEPT]   = &&CJP_LABEL_ITEM_SEPT,
+        [CJP_CLASS_DICT_SEPT]   = &&CJP_LABEL_DICT_SEPT,
+        [CJP_CLASS_STRING]      = &&CJP_LABEL_STRING,
+        [CJP_CLASS_NUMBER]      = &&CJP_LABEL_NUMBER,
+        [CJP_CLASS_TRUE]        = &&CJP_LABEL_TRUE,
+        [CJP_CLASS_FALSE]       = &&CJP_LABEL_FALSE,
+        [CJP_CLASS_NULL]        = &&CJP_LABEL_NULL
+    };
+#endif
+
+    // The root is opened here, so the loop below always has an open container and doesn't check the stack per character
+    if (GS_IS_EMPTY(ctx->objectStack))
+    {
+        // Skip leading characters
+        while ((str < endPtr) && (*str != '{') && (*str != '[')) str++;
+
+        if (str == endPtr)
+        {
+            *strPtr = str;
+            return cJSON_Ok;
+        }
+
+        result = cJSON_Parser_Charge(ctx, 1, cJSON_Parser_ValueCost((*str == '{') ? Dictionary : List));
+        if (result != cJSON_Ok) goto parseError;
+
+        if (*str == '{')
+        {
+            *GObjPtr = allocGenObj(arena, Dictionary);
+            pFlags = CJP_DICT_END_POSSIBLE | CJP_DICT_KEY_POSSIBLE;
+        }
+        else
+        {
+            *GObjPtr = allocGenObj(arena, List);
+            pFlags = CJP_LIST_END_POSSIBLE | CJP_LIST_VALUE_POSSIBLE;
+        }
+
+        GS_Push(&ctx->objectStack, *GObjPtr);
+        CJSON_STATS_ADD(tokens[GObjPtr->type], 1);
+
+        if ((ctx->spans != NULL) && !SPAN_Open(ctx->spans, *GObjPtr, str - ctx->spanBase))
+        {
+            result = cJSON_NotAllocated_Error;
+            goto parseError;
+        }
+
+        str++;
+    }
+
+    // Loop through string's contents
+    while (str < endPtr)
+    {
+        charClass = cJSON_Parser_CharClass[(uint8_t)*str];
+
+        // Token at invalid location in structure (or invalid character)
+        if (!(pFlags & cJSON_Parser_ClassFlags[charClass])) goto structureError;
+
+        CJP_DISPATCH(charClass)
+        {
+        CJP_CASE(WHITESPACE):
+            // Skip the whole run (indentation), the next token is dispatched right away
+            str = SCAN_SkipWhitespace(str, endPtr) - 1;
+            CJP_NEXT();
+        CJP_CASE(DICT_START):
+        CJP_CASE(LIST_START):
+        {
+            cJSON_ContainerType_t containerType = (charClass == CJP_CLASS_DICT_START) ? Dictionary : List;
+
+            // Check the configured depth, the new container is nested one level below the top of the stack
+            if ((ctx->limits.maxDepth != 0) && ((size_t)ctx->objectStack.index + 2 > ctx->limits.maxDepth))
+            {
+                result = cJSON_LimitExceeded_Error;
+                goto parseError;
+            }
+
+            result = cJSON_Parser_Charge(ctx, 1, cJSON_Parser_ValueCost(containerType));
+            if (result != cJSON_Ok) goto parseError;
+
+            // Start container, allocate generic container object and add it to the enclosing container
+            cJSON_Generic_t containerObj = allocGenObj(arena, containerType);
+
+            result = cJSON_Parser_AddValue(ctx, GObjPtr, &pFlags, containerObj);
+            if (result != cJSON_Ok) goto parseError;
+
+            // Push container object to stack, check if JSON structure is within depth range
+            if (GS_Push(&ctx->objectStack, containerObj) != GS_Ok)
+            {
+                result = cJSON_DepthOutOfRange_Error;
+                goto parseError;
+            }
+
+            if ((ctx->spans != NULL) && !SPAN_Open(ctx->spans, containerObj, str - ctx->spanBase))
+            {
+                result = cJSON_NotAllocated_Error;
+                goto parseError;
+            }
+
+            pFlags = (containerType == Dictionary) ? (CJP_DICT_END_POSSIBLE | CJP_DICT_KEY_POSSIBLE) : (CJP_LIST_END_POSSIBLE | CJP_LIST_VALUE_POSSIBLE);
+            CJP_NEXT();
+        }
+        CJP_CASE(DICT_END):
+        CJP_CASE(LIST_END):
+            // Sorted key tables live in the context's arena
+            if ((charClass == CJP_CLASS_DICT_END) && ctx->sortKeys && ctx->useArena && (AS_DICT_PTR(GS_TOP(ctx->objectStack))->length >= CJSON_DICT_SORT_MIN_LENGTH))
+            {
+                cJSON_buildDictSortedKeys(arena, AS_DICT_PTR(GS_TOP(ctx->objectStack)));
+            }
+
+            // End container, remove generic container object from stack
+            GS_Pop(&ctx->objectStack);
+            if (ctx->spans != NULL) SPAN_Close(ctx->spans, str + 1 - ctx->spanBase);
+
+            pFlags = cJSON_Parser_FlagsAfterClose(ctx);
+
+            if (pFlags == 0)
+            {
+                // Root structure complete
+                ctx->parserFlags = 0;
+                *strPtr = str;
+                return cJSON_Ok;
+            }
+            CJP_NEXT();
+        CJP_CASE(ITEM_SEPT):
+            // Separators only follow items, whose flags tell the type of the enclosing container
+            pFlags = (pFlags & CJP_DICT_END_POSSIBLE) ? CJP_DICT_KEY_POSSIBLE : CJP_LIST_VALUE_POSSIBLE;
+            CJP_NEXT();
+        CJP_CASE(DICT_SEPT):
+            pFlags = CJP_DICT_VALUE_POSSIBLE;
+            CJP_NEXT();
+        CJP_CASE(STRING):
+            if (pFlags & CJP_DICT_KEY_POSSIBLE)
+            {
+                // String is a dictionary key, extract key string to the key scratch buffer
+                result = cJSON_Parser_BoundedStringBuilder(&str, endPtr, &ctx->keyBuffer, cJSON_Parser_StringBound(ctx));
+                CJSON_STATS_ADD(keys, 1);
+
+                // Key pointer, inline slot and length, longer keys are stored separately
+                if (result == cJSON_Ok)
+                {
+                    size_t keyBytes = sizeof(cJSON_Key_t) + CJSON_KEY_INLINE_SIZE + sizeof(uint32_t);
+                    if (ctx->keyBuffer.bufferSize + 1 > CJSON_KEY_INLINE_SIZE) keyBytes += ctx->keyBuffer.bufferSize + 1;
+
+                    result = cJSON_Parser_Charge(ctx, 0, keyBytes);
+                }
+
+                pFlags = CJP_DICT_SEPT_POSSIBLE;
+            }
+            else
+            {
+                // String is a value, extract string to the string scratch buffer and copy it to the generic object's data container
+                result = cJSON_Parser_BoundedStringBuilder(&str, endPtr, &ctx->strBuffer, cJSON_Parser_StringBound(ctx));
+
+                if (result == cJSON_Ok) result = cJSON_Parser_Charge(ctx, 1, cJSON_Parser_ValueCost(String) + 1 + ctx->strBuffer.bufferSize);
+
+                if (result == cJSON_Ok)
+                {
+                    cJSON_Generic_t genericStrObj = allocGenObj(arena, String);
+                    genericStrObj.strSize = (uint32_t)(1 + ctx->strBuffer.bufferSize);
+                    genericStrObj.dataContainer = cJSON_alloc(arena, 1 + ctx->strBuffer.bufferSize);
+                    memcpy(genericStrObj.dataContainer, SDB_GetStr(&ctx->strBuffer), 1 + ctx->strBuffer.bufferSize);
+
+                    result = cJSON_Parser_AddValue(ctx, GObjPtr, &pFlags, genericStrObj);
+                }
+            }
+
+            // Check if string was parsed successfully
+            if (result != cJSON_Ok) goto parseError;
+            CJP_NEXT();
+        CJP_CASE(NUMBER):
+            result = cJSON_Parser_AddNumber(ctx, GObjPtr, &pFlags, &str, endPtr);
+            if (result != cJSON_Ok) goto parseError;
+            CJP_NEXT();
+        CJP_CASE(TRUE):
+        CJP_CASE(FALSE):
+        {
+            bool boolVal = (charClass == CJP_CLASS_TRUE);
+            size_t literalLen = boolVal ? 4 : 5;
+
+            if (!cJSON_Parser_MatchLiteral(str, endPtr, boolVal ? "true" : "false", literalLen))
+            {
+                result = cJSON_InvalidCharacterSequence_Error;
+                goto parseError;
+            }
+
+            // Skip the literal's remaining characters
+            str += literalLen - 1;
+
+            if (!(pFlags & (CJP_DICT_VALUE_POSSIBLE | CJP_LIST_VALUE_POSSIBLE))) goto structureError;
+
+            result = cJSON_Parser_Charge(ctx, 1, cJSON_Parser_ValueCost(Boolean));
+            if (result != cJSON_Ok) goto parseError;
+
+            cJSON_Generic_t boolObj = allocGenObj(arena, Boolean);
+            AS_BOOL(boolObj) = boolVal;
+
+            result = cJSON_Parser_AddValue(ctx, GObjPtr, &pFlags, boolObj);
+            if (result != cJSON_Ok) goto parseError;
+            CJP_NEXT();
+        }
+        CJP_CASE(NULL):
+            if (!cJSON_Parser_MatchLiteral(str, endPtr, "null", 4))
+            {
+                result = cJSON_InvalidCharacterSequence_Error;
+                goto parseError;
+            }
+
+            // Skip the literal's remaining characters
+            str += 3;
+
+            if (!(pFlags & (CJP_DICT_VALUE_POSSIBLE | CJP_LIST_VALUE_POSSIBLE))) goto structureError;
+
+            result = cJSON_Parser_Charge(ctx, 1, cJSON_Parser_ValueCost(NullType));
+            if (result == cJSON_Ok) result = cJSON_Parser_AddValue(ctx, GObjPtr, &pFlags, allocGenObj(arena, NullType));
+            if (result != cJSON_Ok) goto parseError;
+            CJP_NEXT();
+        }
+
+#ifndef CJP_USE_COMPUTED_GOTO
+    nextChar:
+        // Handle next character
+        str++;
+#endif
+    }
+
+#ifdef CJP_USE_COMPUTED_GOTO
+rangeEnd:
+#endif
+    // End of range reached before the root structure was closed, keep the parser state for the next range
+    ctx->parserFlags = pFlags;
+    *strPtr = str;
+    return cJSON_Ok;
+
+structureError:
+    result = cJSON_Structure_Error;
+parseError:
+    *strPtr = str;
+    return result;
+}
+cJSON_Result_t cJSON_Parser_Resume(cJSON_ParseContext_t *ctx, cJSON_Generic_t *GObjPtr, const char **strPtr, const char *endPtr)
+{
+    CJSON_STATS_BEGIN(cJSON_ParsePhase, startTime);
+    const char *startPtr = *strPtr;
+
+    cJSON_Result_t result = cJSON_Parser_Run(ctx, GObjPtr, strPtr, endPtr);
+
+    // The string pointer is left at the last processed character unless the range was used up
+    CJSON_STATS_ADD(bytes, ((*strPtr < endPtr) ? (*strPtr + 1) : endPtr) - startPtr);
+    CJSON_STATS_END(cJSON_ParsePhase, startTime);
+
+    return result;
+}
+
+bool cJSON_Parser_IsComplete(const cJSON_ParseContext_t *ctx, cJSON_Generic_t GObj)
+{
+    // The root is pushed when it is opened and popped when it is closed
+    return (GObj.dataContainer != NULL) && GS_IS_EMPTY(ctx->objectStack);
+}
+
+/**
+ * @brief   Parser core. Parses the first JSON structure found in the range between *strPtr and endPtr.
+ * 
+ * @param   ctx Parse context.
+ * @param   GObjPtr cJSON_Generic pointer, where the parsed structure will be saved in.
+ * @param   strPtr Pointer to the string pointer. Points to the closing character of the root structure on success.
+ * @param   endPtr Pointer behind the last character of the string.
+ * @return  cJSON_Result_t Parse result. The partially parsed structure is left in GObjPtr on error.
+ */
+static cJSON_Result_t cJSON_Parser_ParseRange(cJSON_ParseContext_t *ctx, cJSON_Generic_t *GObjPtr, const char **strPtr, const char *endPtr)
+{
+    // Reset transient parser state, arena contents are kept
+    GS_Clear(&ctx->objectStack);
+    ctx->parserFlags = 0;
+    ctx->nodeCount = 0;
+    ctx->byteCount = 0;
+    GObjPtr->type = NullType;
+    GObjPtr->dataContainer = NULL;
+
+    cJSON_Result_t result = cJSON_Parser_Resume(ctx, GObjPtr, strPtr, endPtr);
+
+    // Range ended before the root structure was closed
+    if ((result == cJSON_Ok) && !cJSON_Parser_IsComplete(ctx, *GObjPtr)) result = cJSON_Structure_Error;
+
+    return result;
+}
+
+#pragma endregion
+
+// - Clone Helper Functions -
+#pragma region Clone Helper Functions
+
+/**
+ * @brief   Takes size bytes from the clone's memory block or, if blockCursor is NULL, from the heap.
+ * 
+ * @param   blockCursor Pointer to the cursor of the clone's memory block. NULL selects the heap.
+ * @param   size Number of bytes.
+ * @param   aligned If true, the memory is aligned to CJSON_ARENA_ALIGN (structs and arrays). Strings are packed without alignment.
+ * @return  void* Pointer to the memory, NULL for zero sized requests.
+ */
+static void* cJSON_Clone_Take(unsigned char **blockCursor, size_t size, bool aligned)
+{
+    if (size == 0) return NULL;
+    if (blockCursor == NULL) return malloc(size);
+
+    if (aligned)
+    {
+        uintptr_t misalignment = (uintptr_t)*blockCursor & (CJSON_ARENA_ALIGN - 1);
+        if (misalignment) *blockCursor += CJSON_ARENA_ALIGN - misalignment;
+    }
+
+    void *takenPtr = *blockCursor;
+    *blockCursor += size;
+
+    return takenPtr;
+}
+
+/**
+ * @brief   Sizing pass. Returns the number of bytes needed to clone GObj's data container into a single block (worst case alignment padding included).
+ * 
+ * @param   GObj cJSON_Generic_t object.
+ * @return  size_t Size in bytes.
+ */
+static size_t cJSON_Clone_Size(cJSON_Generic_t GObj)
+{
+    const size_t alignPad = CJSON_ARENA_ALIGN - 1;
+    size_t size = 0;
+
+    if (GObj.dataContainer == NULL) return 0;
+
+    switch (GObj.type)
+    {
+    case Dictionary:
+        size += sizeof(cJSON_Dict_t) + alignPad;
+        if (AS_DICT_PTR(GObj)->length > 0)
+        {
+            size += AS_DICT_PTR(GObj)->length * (sizeof(cJSON_Key_t) + CJSON_KEY_INLINE_SIZE + sizeof(uint32_t)) + alignPad;
+            size += AS_DICT_PTR(GObj)->length * sizeof(cJSON_Generic_t) + alignPad;
+        }
+        for (cJSON_object_size_size_t i = 0; i < AS_DICT_PTR(GObj)->length; i++)
+        {
+            size_t keySize = 1 + cJSON_getDictKeyLength(AS_DICT_PTR(GObj), i);
+            if (keySize > CJSON_KEY_INLINE_SIZE) size += keySize;
+            size += cJSON_Clone_Size(AS_DICT_PTR(GObj)->valueData[i]);
+        }
+        break;
+    case List:
+        size += sizeof(cJSON_List_t) + alignPad;
+        if (AS_LIST_PTR(GObj)->length > 0) size += AS_LIST_PTR(GObj)->length * sizeof(cJSON_Generic_t) + alignPad;
+        for (cJSON_object_size_size_t i = 0; i < AS_LIST_PTR(GObj)->length; i++)
+        {
+            size += cJSON_Clone_Size(AS_LIST_PTR(GObj)->data[i]);
+        }
+        break;
+    case String:
+        size += 1 + AS_STRING_LENGTH(GObj);
+        break;
+    case Integer:
+        size += sizeof(cJSON_Int_t) + alignPad;
+        break;
+    case Float:
+        size += sizeof(cJSON_Float_t) + alignPad;
+        break;
+    case Boolean:
+        size += sizeof(cJSON_Bool_t) + alignPad;
+        break;
+    case IntArray:
+        size += sizeof(cJSON_IntArray_t) + alignPad;
+        if (AS_INT_ARRAY_PTR(GObj)->length > 0) size += AS_INT_ARRAY_PTR(GObj)->length * sizeof(cJSON_Int_t) + alignPad;
+        break;
+    case FloatArray:
+        size += sizeof(cJSON_FloatArray_t) + alignPad;
+        if (AS_FLOAT_ARRAY_PTR(GObj)->length > 0) size += AS_FLOAT_ARRAY_PTR(GObj)->length * sizeof(cJSON_Float_t) + alignPad;
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+/**
+ * @brief   Checks if the copy of GObj failed, failed copies have no data container.
+ * 
+ */
+static inline bool cJSON_Clone_Failed(cJSON_Generic_t GObj, cJSON_Generic_t copyObj)
+{
+    return (copyObj.dataContainer == NULL) && (GObj.dataContainer != NULL);
+}
+
+/**
+ * @brief   Copy pass. Copies GObj's data container, container arrays are copied in bulk and their children are redirected to their copies afterwards.
+ * 
+ * @param   GObj cJSON_Generic_t object.
+ * @param   blockCursor Pointer to the cursor of the clone's memory block. NULL selects the heap.
+ * @return  cJSON_Generic_t Copy of GObj. If a heap allocation fails, the partial copy is freed and the returned copy has no data container (see cJSON_Clone_Failed). Allocations from the block can't fail.
+ */
+static cJSON_Generic_t cJSON_Clone_Copy(cJSON_Generic_t GObj, unsigned char **blockCursor)
+{
+    cJSON_Generic_t copyObj = GObj;
+    size_t valueSize;
+
+    if (GObj.dataContainer == NULL) return copyObj;
+
+    switch (GObj.type)
+    {
+    case Dictionary:;
+        cJSON_Dict_t *srcDict = AS_DICT_PTR(GObj);
+        cJSON_Dict_t *dstDict = (cJSON_Dict_t*)cJSON_Clone_Take(blockCursor, sizeof(cJSON_Dict_t), true);
+        cJSON_object_size_size_t dictCopied = 0;
+
+        copyObj.dataContainer = dstDict;
+        if (dstDict == NULL) return copyObj;
+
+        dstDict->length = srcDict->length;
+        dstDict->capacity = srcDict->length;
+        dstDict->keyIndex = NULL;
+        dstDict->keyIndexMask = 0;
+        dstDict->sortedKeys = NULL;
+        dstDict->sortedKeysOffset = 0;
+        dstDict->arenaOwned = (blockCursor != NULL);
+        dstDict->keyData = (cJSON_Key_t*)cJSON_Clone_Take(blockCursor, srcDict->length * (sizeof(cJSON_Key_t) + CJSON_KEY_INLINE_SIZE + sizeof(uint32_t)), true);
+        dstDict->valueData = (cJSON_Generic_t*)cJSON_Clone_Take(blockCursor, srcDict->length * sizeof(cJSON_Generic_t), true);
+
+        if ((srcDict->length > 0) && ((dstDict->keyData == NULL) || (dstDict->valueData == NULL))) goto dictError;
+
+        // Bulk copy value array, scalar types and NullType entries are complete afterwards
+        if (srcDict->length > 0) memcpy(dstDict->valueData, srcDict->valueData, srcDict->length * sizeof(cJSON_Generic_t));
+
+        for (cJSON_object_size_size_t i = 0; i < srcDict->length; i++)
+        {
+            // Same key layout as cJSON_appendToDict, short keys go to their inline slot, the lengths follow the slots
+            size_t keySize = 1 + cJSON_getDictKeyLength(srcDict, i);
+            char *inlineKeys = (char*)(dstDict->keyData + dstDict->length);
+            dstDict->keyData[i] = (keySize <= CJSON_KEY_INLINE_SIZE) ? (inlineKeys + i * CJSON_KEY_INLINE_SIZE)
+                                                                     : (cJSON_Key_t)cJSON_Clone_Take(blockCursor, keySize, false);
+            if (dstDict->keyData[i] == NULL) goto dictError;
+
+            memcpy(dstDict->keyData[i], srcDict->keyData[i], keySize);
+            ((uint32_t*)(inlineKeys + dstDict->length * CJSON_KEY_INLINE_SIZE))[i] = (uint32_t)(keySize - 1);
+
+            dstDict->valueData[i] = cJSON_Clone_Copy(srcDict->valueData[i], blockCursor);
+            if (cJSON_Clone_Failed(srcDict->valueData[i], dstDict->valueData[i]))
+            {
+                cJSON_freeDictKey(dstDict, i);
+                goto dictError;
+            }
+
+            dictCopied++;
+        }
+
+        return copyObj;
+    dictError:
+        // Only the entries copied so far belong to the copy, the key layout follows the capacity and stays valid
+        dstDict->length = dictCopied;
+        cJSON_delGenObj(copyObj);
+
+        copyObj.dataContainer = NULL;
+        return copyObj;
+    case List:;
+        cJSON_List_t *srcList = AS_LIST_PTR(GObj);
+        cJSON_List_t *dstList = (cJSON_List_t*)cJSON_Clone_Take(blockCursor, sizeof(cJSON_List_t), true);
+        cJSON_object_size_size_t listCopied = 0;
+
+        copyObj.dataContainer = dstList;
+        if (dstList == NULL) return copyObj;
+
+        dstList->length = srcList->length;
+        dstList->capacity = srcList->length;
+        dstList->arenaOwned = (blockCursor != NULL);
+        dstList->data = (cJSON_Generic_t*)cJSON_Clone_Take(blockCursor, srcList->length * sizeof(cJSON_Generic_t), true);
+
+        if ((srcList->length > 0) && (dstList->data == NULL)) goto listError;
+
+        // Bulk copy data array
+        if (srcList->length > 0) memcpy(dstList->data, srcList->data, srcList->length * sizeof(cJSON_Generic_t));
+
+        for (cJSON_object_size_size_t i = 0; i < srcList->length; i++)
+        {
+            dstList->data[i] = cJSON_Clone_Copy(srcList->data[i], blockCursor);
+            if (cJSON_Clone_Failed(srcList->data[i], dstList->data[i])) goto listError;
+
+            listCopied++;
+        }
+
+        return copyObj;
+    listError:
+        dstList->length = listCopied;
+        cJSON_delGenObj(copyObj);
+
+        copyObj.dataContainer = NULL;
+        return copyObj;
+    case IntArray:;
+        cJSON_IntArray_t *dstIntArr = (cJSON_IntArray_t*)cJSON_Clone_Take(blockCursor, sizeof(cJSON_IntArray_t), true);
+
+        copyObj.dataContainer = dstIntArr;
+        if (dstIntArr == NULL) return copyObj;
+
+        dstIntArr->length = AS_INT_ARRAY_PTR(GObj)->length;
+        dstIntArr->capacity = dstIntArr->length;
+        dstIntArr->data = (cJSON_Int_t*)cJSON_Clone_Take(blockCursor, dstIntArr->length * sizeof(cJSON_Int_t), true);
+
+        if ((dstIntArr->length > 0) && (dstIntArr->data == NULL))
+        {
+            free(dstIntArr);
+
+            copyObj.dataContainer = NULL;
+            return copyObj;
+        }
+
+        if (dstIntArr->length > 0) memcpy(dstIntArr->data, AS_INT_ARRAY_PTR(GObj)->data, dstIntArr->length * sizeof(cJSON_Int_t));
+
+        return copyObj;
+    case FloatArray:;
+        cJSON_FloatArray_t *dstFloatArr = (cJSON_FloatArray_t*)cJSON_Clone_Take(blockCursor, sizeof(cJSON_FloatArray_t), true);
+
+        copyObj.dataContainer = dstFloatArr;
+        if (dstFloatArr == NULL) return copyObj;
+
+        dstFloatArr->length = AS_FLOAT_ARRAY_PTR(GObj)->length;
+        dstFloatArr->capacity = dstFloatArr->length;
+        dstFloatArr->data = (cJSON_Float_t*)cJSON_Clone_Take(blockCursor, dstFloatArr->length * sizeof(cJSON_Float_t), true);
+
+        if ((dstFloatArr->length > 0) && (dstFloatArr->data == NULL))
+        {
+            free(dstFloatArr);
+
+            copyObj.dataContainer = NULL;
+            return copyObj;
+        }
+
+        if (dstFloatArr->length > 0) memcpy(dstFloatArr->data, AS_FLOAT_ARRAY_PTR(GObj)->data, dstFloatArr->length * sizeof(cJSON_Float_t));
+
+        return copyObj;
+    case String:
+        // Copies embedded null characters too, the size is kept in copyObj
+        valueSize = 1 + AS_STRING_LENGTH(GObj);
+        copyObj.dataContainer = cJSON_Clone_Take(blockCursor, valueSize, false);
+        if (copyObj.dataContainer != NULL) memcpy(copyObj.dataContainer, GObj.dataContainer, valueSize);
+        return copyObj;
+    case Integer:
+        valueSize = sizeof(cJSON_Int_t);
+        break;
+    case Float:
+        valueSize = sizeof(cJSON_Float_t);
+        break;
+    case Boolean:
+        valueSize = sizeof(cJSON_Bool_t);
+        break;
+    default:
+        return copyObj;
+    }
+
+    copyObj.dataContainer = cJSON_Clone_Take(blockCursor, valueSize, true);
+    if (copyObj.dataContainer != NULL) memcpy(copyObj.dataContainer, GObj.dataContainer, valueSize);
+
+    return copyObj;
+}
+
+#pragma endregion
+
+// - Structural Helper Functions -
+#pragma region Structural Helper Functions
+
+/**
+ * @brief   Checks if GObj is a heap allocated dictionary, which the in-place mutation functions can modify.
+ * 
+ */
+static inline bool cJSON_Struct_IsHeapDict(cJSON_Generic_t GObj)
+{
+    return (GObj.type == Dictionary) && !AS_DICT_PTR(GObj)->arenaOwned;
+}
+/**
+ * @brief   Checks if GObj is a heap allocated generic list, which the in-place mutation functions can modify.
+ * 
+ */
+static inline bool cJSON_Struct_IsHeapList(cJSON_Generic_t GObj)
+{
+    return (GObj.type == List) && !AS_LIST_PTR(GObj)->arenaOwned;
+}
+
+#pragma endregion
+
 //   ---   Function Implementations   ---
 
 // - Structural Functions -
@@ -18,9 +968,21 @@
 
 cJSON_Result_t cJSON_tryAppendToDict(cJSON_Generic_t *GObjPtr, const cJSON_Key_t key, cJSON_Generic_t valObj)
 {
-    if (GObjPtr->type == Dictionary)
+    if (cJSON_Struct_IsHeapDict(*GObjPtr))
+    {
+        cJSON_appendToDict(NULL, AS_DICT_PTR(*GObjPtr), key, strlen(key), valObj);
+        return cJSON_Ok;
+    }
+    else
+    {
+        return cJSON_Datatype_Error;
+    }
+}
+cJSON_Result_t cJSON_tryAppendToList(cJSON_Generic_t *GObjPtr, cJSON_Generic_t obj)
+{
+    if (cJSON_Struct_IsHeapList(*GObjPtr))
     {
-        cJSON_appendToDict(AS_DICT_PTR(*GObjPtr), key, valObj);
+        cJSON_appendToList(NULL, AS_LIST_PTR(*GObjPtr), obj);
         return cJSON_Ok;
     }
     else
@@ -28,17 +990,88 @@ cJSON_Result_t cJSON_tryAppendToDict(cJSON_Generic_t *GObjPtr, const cJSON_Key_t
         return cJSON_Datatype_Error;
     }
 }
-cJSON_Result_t cJSON_tryAppendToList(cJSON_Generic_t *GObjPtr, cJSON_Generic_t obj)
+
+cJSON_Result_t cJSON_tryInsertIntoDict(cJSON_Generic_t *GObjPtr, cJSON_object_size_size_t index, const cJSON_Key_t key, cJSON_Generic_t valObj)
+{
+    if (!cJSON_Struct_IsHeapDict(*GObjPtr))                return cJSON_Datatype_Error;
+    if (index > AS_DICT_PTR(*GObjPtr)->length)      return cJSON_NotFound_Error;
+
+    cJSON_insertIntoDict(NULL, AS_DICT_PTR(*GObjPtr), index, key, strlen(key), valObj);
+    return cJSON_Ok;
+}
+cJSON_Result_t cJSON_tryInsertIntoList(cJSON_Generic_t *GObjPtr, cJSON_object_size_size_t index, cJSON_Generic_t obj)
+{
+    if (!cJSON_Struct_IsHeapList(*GObjPtr))                return cJSON_Datatype_Error;
+    if (index > AS_LIST_PTR(*GObjPtr)->length)      return cJSON_NotFound_Error;
+
+    cJSON_insertIntoList(NULL, AS_LIST_PTR(*GObjPtr), index, obj);
+    return cJSON_Ok;
+}
+
+cJSON_Result_t cJSON_tryReplaceInDict(cJSON_Generic_t *GObjPtr, const cJSON_Key_t key, cJSON_Generic_t valObj)
+{
+    cJSON_object_size_size_t index;
+
+    if (!cJSON_Struct_IsHeapDict(*GObjPtr))                                    return cJSON_Datatype_Error;
+    if (!cJSON_findDictKey(AS_DICT_PTR(*GObjPtr), key, 0, &index))      return cJSON_NotFound_Error;
+
+    cJSON_delGenObj(AS_DICT_PTR(*GObjPtr)->valueData[index]);
+    AS_DICT_PTR(*GObjPtr)->valueData[index] = valObj;
+    return cJSON_Ok;
+}
+cJSON_Result_t cJSON_tryReplaceInList(cJSON_Generic_t *GObjPtr, cJSON_object_size_size_t index, cJSON_Generic_t obj)
+{
+    if (!cJSON_Struct_IsHeapList(*GObjPtr))                return cJSON_Datatype_Error;
+    if (index >= AS_LIST_PTR(*GObjPtr)->length)     return cJSON_NotFound_Error;
+
+    cJSON_delGenObj(AS_LIST_PTR(*GObjPtr)->data[index]);
+    AS_LIST_PTR(*GObjPtr)->data[index] = obj;
+    return cJSON_Ok;
+}
+
+cJSON_Result_t cJSON_tryRemoveFromDict(cJSON_Generic_t *GObjPtr, const cJSON_Key_t key)
+{
+    cJSON_object_size_size_t index;
+
+    if (!cJSON_Struct_IsHeapDict(*GObjPtr))                                    return cJSON_Datatype_Error;
+    if (!cJSON_findDictKey(AS_DICT_PTR(*GObjPtr), key, 0, &index))      return cJSON_NotFound_Error;
+
+    cJSON_delGenObj(cJSON_detachFromDict(AS_DICT_PTR(*GObjPtr), index));
+    return cJSON_Ok;
+}
+cJSON_Result_t cJSON_tryRemoveFromDictAt(cJSON_Generic_t *GObjPtr, cJSON_object_size_size_t index)
+{
+    if (!cJSON_Struct_IsHeapDict(*GObjPtr))                return cJSON_Datatype_Error;
+    if (index >= AS_DICT_PTR(*GObjPtr)->length)     return cJSON_NotFound_Error;
+
+    cJSON_delGenObj(cJSON_detachFromDict(AS_DICT_PTR(*GObjPtr), index));
+    return cJSON_Ok;
+}
+cJSON_Result_t cJSON_tryRemoveFromList(cJSON_Generic_t *GObjPtr, cJSON_object_size_size_t index)
 {
-    if (GObjPtr->type == List)
-    {
-        cJSON_appendToList(AS_LIST_PTR(*GObjPtr), obj);
-        return cJSON_Ok;
-    }
-    else
-    {
-        return cJSON_Datatype_Error;
-    }
+    if (!cJSON_Struct_IsHeapList(*GObjPtr))                return cJSON_Datatype_Error;
+    if (index >= AS_LIST_PTR(*GObjPtr)->length)     return cJSON_NotFound_Error;
+
+    cJSON_delGenObj(cJSON_detachFromList(AS_LIST_PTR(*GObjPtr), index));
+    return cJSON_Ok;
+}
+cJSON_Result_t cJSON_trySwapRemoveFromDict(cJSON_Generic_t *GObjPtr, const cJSON_Key_t key)
+{
+    cJSON_object_size_size_t index;
+
+    if (!cJSON_Struct_IsHeapDict(*GObjPtr))                                    return cJSON_Datatype_Error;
+    if (!cJSON_findDictKey(AS_DICT_PTR(*GObjPtr), key, 0, &index))      return cJSON_NotFound_Error;
+
+    cJSON_delGenObj(cJSON_swapDetachFromDict(AS_DICT_PTR(*GObjPtr), index));
+    return cJSON_Ok;
+}
+cJSON_Result_t cJSON_trySwapRemoveFromList(cJSON_Generic_t *GObjPtr, cJSON_object_size_size_t index)
+{
+    if (!cJSON_Struct_IsHeapList(*GObjPtr))                return cJSON_Datatype_Error;
+    if (index >= AS_LIST_PTR(*GObjPtr)->length)     return cJSON_NotFound_Error;
+
+    cJSON_delGenObj(cJSON_swapDetachFromList(AS_LIST_PTR(*GObjPtr), index));
+    return cJSON_Ok;
 }
 
 cJSON_Result_t cJSON_delGenObj(cJSON_Generic_t GObj)
@@ -52,8 +1085,8 @@ cJSON_Result_t cJSON_delGenObj(cJSON_Generic_t GObj)
             // Delete all cJSON_Generic_t objects and free the memory of all key strings stored in this cJSON_Dict_t object.
             for (cJSON_object_size_size_t i = 0; i < AS_DICT_PTR(GObj)->length; i++)
             {
-                // Free the key string pointer (char**) stored at index i.
-                free(AS_DICT_PTR(GObj)->keyData[i]);
+                // Free the key string stored at index i (inline keys are part of the key array).
+                cJSON_freeDictKey(AS_DICT_PTR(GObj), i);
                 // Delete the cJSON_Generic_t object stored at index i.
                 cJSON_delGenObj((AS_DICT_PTR(GObj)->valueData[i]));
             }
@@ -72,6 +1105,17 @@ cJSON_Result_t cJSON_delGenObj(cJSON_Generic_t GObj)
                 cJSON_delGenObj((AS_LIST_PTR(GObj)->data[i]));
             }
 
+            // Free the memory of the data array.
+            free(AS_LIST_PTR(GObj)->data);
+
+            // Free the memory of the data container itself.
+            free(GObj.dataContainer);
+            break;
+        case IntArray:
+        case FloatArray:
+            // Free the memory of the value array (same layout for both array types).
+            free(AS_INT_ARRAY_PTR(GObj)->data);
+
             // Free the memory of the data container itself.
             free(GObj.dataContainer);
             break;
@@ -82,6 +1126,44 @@ cJSON_Result_t cJSON_delGenObj(cJSON_Generic_t GObj)
             break;
         }
     }
+
+    return cJSON_Ok;
+}
+
+cJSON_Result_t cJSON_tryUnpackList(cJSON_Generic_t *GObjPtr)
+{
+    if (!IS_LIST_TYPE(GObjPtr->type))   return cJSON_Datatype_Error;
+
+    if (GObjPtr->type != List) *GObjPtr = cJSON_unpackArray(NULL, *GObjPtr);
+    return cJSON_Ok;
+}
+
+cJSON_Result_t cJSON_clone(cJSON_Generic_t src, cJSON_Generic_t *dst, const cJSON_CloneOptions_t *opts)
+{
+    if ((opts != NULL) && (opts->arena != NULL))
+    {
+        // Sizing pass, then a single contiguous block for the whole clone
+        size_t cloneSize = cJSON_Clone_Size(src);
+        unsigned char *blockCursor = NULL;
+
+        if (cloneSize > 0)
+        {
+            blockCursor = (unsigned char*)ARENA_Alloc(opts->arena, cloneSize);
+            if (blockCursor == NULL) return cJSON_NotAllocated_Error;
+        }
+
+        *dst = cJSON_Clone_Copy(src, &blockCursor);
+    }
+    else
+    {
+        // Heap allocated clone, compatible with cJSON_delGenObj
+        cJSON_Generic_t copyObj = cJSON_Clone_Copy(src, NULL);
+        if (cJSON_Clone_Failed(src, copyObj)) return cJSON_NotAllocated_Error;
+
+        *dst = copyObj;
+    }
+
+    return cJSON_Ok;
 }
 
 #pragma endregion
@@ -91,382 +1173,193 @@ cJSON_Result_t cJSON_delGenObj(cJSON_Generic_t GObj)
 
 cJSON_Result_t cJSON_parseStr(cJSON_Generic_t *GObjPtr, const char *str)
 {
-    // Create object stack
-    cJSON_GenericStack_t ObjectStack = GS_Create(CJSON_MAX_DEPTH);
+    // Single use context, structures are heap allocated and owned by the caller
+    cJSON_ParseContext_t ctx = cJSON_createParseContext(false);
 
-    // Temporary storage
-    // Active dictionary key temporary storage
-    cJSON_Key_t activeKey;
+    cJSON_Result_t result = cJSON_parseStrWithContext(&ctx, GObjPtr, str);
 
-    uint8_t pFlags = 0;
+    cJSON_deleteParseContext(&ctx);
 
-    // Loop through string's contents
-    while (*str)
+    return result;
+}
+
+cJSON_Result_t cJSON_parseStrWithLimits(cJSON_Generic_t *GObjPtr, const char *str, const cJSON_ParseLimits_t *limits)
+{
+    cJSON_ParseContext_t ctx = cJSON_createParseContext(false);
+    ctx.limits = *limits;
+
+    cJSON_Result_t result = cJSON_parseStrWithContext(&ctx, GObjPtr, str);
+
+    cJSON_deleteParseContext(&ctx);
+
+    return result;
+}
+
+cJSON_Result_t cJSON_parseMany(cJSON_ParseContext_t *ctx, const char *buf, size_t len, cJSON_DocSpan_t results[], size_t max, size_t *count, size_t *consumed)
+{
+    const char *str = buf;
+    const char *endPtr = buf + len;
+    cJSON_Result_t result = cJSON_Ok;
+
+    *count = 0;
+
+    str = SCAN_SkipWhitespace(str, endPtr);
+    *consumed = (size_t)(str - buf);
+
+    while ((*count < max) && (str < endPtr))
     {
-        if (GS_IS_EMPTY(ObjectStack))
+        // Unlike cJSON_Parser_ParseRange, nothing but whitespace is skipped between documents
+        if ((*str != '{') && (*str != '['))
         {
-            if (*str == '{')
-            {
-                *GObjPtr = mallocGenObj(Dictionary);
-                pFlags = CJP_DICT_END_POSSIBLE | CJP_DICT_KEY_POSSIBLE;
-            }
-            else if (*str == '[')
-            {
-                *GObjPtr = mallocGenObj(List);
-                pFlags = CJP_LIST_END_POSSIBLE | CJP_LIST_VALUE_POSSIBLE;
-            }
-            else
-            {
-                // Skip leading characters
-                str++;
-                continue;
-            }
-
-            GS_Push(&ObjectStack, *GObjPtr);
+            result = cJSON_Structure_Error;
+            break;
         }
-        else
+
+        cJSON_DocSpan_t *doc = &results[*count];
+        const char *startPtr = str;
+
+        result = cJSON_Parser_ParseRange(ctx, &doc->root, &str, endPtr);
+
+        if (result != cJSON_Ok)
         {
-            switch (LOWER_CASE_CHAR(*str))
-            {
-            case ' ':   // Ignore space character
-            case '\t':  // Ignore tab character
-            case '\n':  // Ignore newline character
-                break;
-            case '{':;
-                // Start dictionary, allocate generic dictionary object
-                cJSON_Generic_t dictObj;
-                dictObj = mallocGenObj(Dictionary);
-
-                // Check if start dictionary is possible
-                if (pFlags & CJP_DICT_VALUE_POSSIBLE)
-                {
-                    cJSON_appendToDict(AS_DICT_PTR(GS_TOP(ObjectStack)), activeKey, dictObj);
-                }
-                else if (pFlags & CJP_LIST_VALUE_POSSIBLE)
-                {
-                    cJSON_appendToList(AS_LIST_PTR(GS_TOP(ObjectStack)), dictObj);
-                }
-                else
-                {
-                    // Dictionary at invalid location in structure, delete object stack, delete generic dictionary object and return error
-                    GS_Delete(&ObjectStack);
-                    cJSON_delGenObj(dictObj);
-                    return cJSON_Structure_Error;
-                }
+            if (!ctx->useArena) cJSON_delGenObj(doc->root);
+            doc->root.type = NullType;
+            doc->root.dataContainer = NULL;
 
-                // Push dictionary object to stack, check if JSON structure is within depth range
-                if (GS_Push(&ObjectStack, dictObj) != GS_Ok)
-                {
-                    // String's JSON structure depth is out of range, delete object stack and return error
-                    GS_Delete(&ObjectStack);
-                    return cJSON_DepthOutOfRange_Error;
-                }
+            // A document cut off by the end of the buffer is parsed again once the rest of it has arrived
+            if (cJSON_Parser_IsCutOff(startPtr, endPtr)) result = cJSON_Ok;
+            break;
+        }
 
-                // Update flags
-                pFlags = CJP_DICT_END_POSSIBLE | CJP_DICT_KEY_POSSIBLE;
-                break;
-            case '}':
-                // Check if end dictionary is possible
-                if (pFlags & CJP_DICT_END_POSSIBLE)
-                {
-                    // End dictionary, remove generic dictionary object from stack
-                    GS_Pop(&ObjectStack);
-
-                    if (GS_IS_EMPTY(ObjectStack))
-                    {
-                        // Clear parser flags, stack is empty, parsing complete, wait for string terminator
-                        pFlags = 0;
-                    }
-                    else if (GS_TOP(ObjectStack).type == Dictionary)
-                    {
-                        pFlags = CJP_DICT_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
-                    }
-                    else
-                    {
-                        pFlags = CJP_LIST_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
-                    }
-                }
-                else
-                {
-                    // Dictionary end at invalid location, delete object stack and return error
-                    GS_Delete(&ObjectStack);
-                    return cJSON_Structure_Error;
-                }
-                break;
-            case '[':;
-                // Start list, allocate generic list object
-                cJSON_Generic_t listObj;
-                listObj = mallocGenObj(List);
-
-                // Check if start list is possible
-                if (pFlags & CJP_DICT_VALUE_POSSIBLE)
-                {
-                    cJSON_appendToDict(AS_DICT_PTR(GS_TOP(ObjectStack)), activeKey, listObj);
-                }
-                else if (pFlags & CJP_LIST_VALUE_POSSIBLE)
-                {
-                    cJSON_appendToList(AS_LIST_PTR(GS_TOP(ObjectStack)), listObj);
-                }
-                else
-                {
-                    // List at invalid location in structure, delete object stack, delete generic list object and return error
-                    GS_Delete(&ObjectStack);
-                    cJSON_delGenObj(listObj);
-                    return cJSON_Structure_Error;
-                }
+        doc->start = (size_t)(startPtr - buf);
+        doc->end = (size_t)(str + 1 - buf);
+        (*count)++;
 
-                // Push list object to stack, check if JSON structure is within depth range
-                if (GS_Push(&ObjectStack, listObj) != GS_Ok)
-                {
-                    // JSON structure depth is out of range, delete object stack and return error
-                    GS_Delete(&ObjectStack);
-                    return cJSON_DepthOutOfRange_Error;
-                }
+        // Whitespace behind a document is used up with it, so resuming doesn't scan it again
+        str = SCAN_SkipWhitespace(str + 1, endPtr);
+        *consumed = (size_t)(str - buf);
+    }
 
-                // Update flags
-                pFlags = CJP_DICT_END_POSSIBLE | CJP_DICT_KEY_POSSIBLE;
-                break;
-            case ']':
-                // Check if end list is possible
-                if (pFlags & CJP_DICT_END_POSSIBLE)
-                {
-                    // End list, remove generic list object from stack
-                    GS_Pop(&ObjectStack);
-
-                    if (GS_IS_EMPTY(ObjectStack))
-                    {
-                        // Clear parser flags, stack is empty, parsing complete, wait for string terminator
-                        pFlags = 0;
-                    }
-                    else if (GS_TOP(ObjectStack).type == Dictionary)
-                    {
-                        pFlags = CJP_DICT_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
-                    }
-                    else
-                    {
-                        pFlags = CJP_LIST_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
-                    }
-                }
-                break;
-            case ',':
-                // Item separator, check if allowed
-                if (pFlags & CJP_ITEM_SEPT_POSSIBLE)
-                {
-                    // Item separator allowed, update flags
-                    if (GS_TOP(ObjectStack).type == Dictionary)
-                        pFlags = CJP_DICT_KEY_POSSIBLE;
-                    else
-                        pFlags = CJP_LIST_VALUE_POSSIBLE;
-                }
-                else
-                {
-                    // Item separator at invalid location detected, delete object stack and return error
-                    GS_Delete(&ObjectStack);
-                    return cJSON_Structure_Error;
-                }
-                break;
-            case ':':
-                // Dictionary key-value separator, check if allowed
-                if (pFlags & CJP_DICT_SEPT_POSSIBLE)
-                {
-                    // Update parser flags
-                    pFlags = CJP_DICT_VALUE_POSSIBLE;
-                }
-                else
-                {
-                    // Dictionary key-value separator at invalid location detected, delete object stack and return error
-                    GS_Delete(&ObjectStack);
-                    return cJSON_Structure_Error;
-                }
-                break;
-            case '"':;
-                // Start of string sequence
-                cJSON_Result_t strBuilderResult;
-                cJSON_Generic_t genericStrObj;
-
-                // Check if string is possible
-                if (pFlags & CJP_DICT_KEY_POSSIBLE)
-                {
-                    // String is a dictionary key, extract key string to activeKey variable
-                    strBuilderResult = cJSON_Parser_StringBuilder(&str, &activeKey);
+    return result;
+}
 
-                    pFlags = CJP_DICT_SEPT_POSSIBLE;
-                }
-                else if (pFlags & CJP_DICT_VALUE_POSSIBLE)
-                {
-                    // String is a dictionary value, extract string to generic object's data container
-                    genericStrObj = mallocGenObj(String);
-                    strBuilderResult = cJSON_Parser_StringBuilder(&str, (char**)(&(genericStrObj.dataContainer)));
+cJSON_Result_t cJSON_parseStrWithContext(cJSON_ParseContext_t *ctx, cJSON_Generic_t *GObjPtr, const char *str)
+{
+    cJSON_Result_t result = cJSON_Parser_ParseRange(ctx, GObjPtr, &str, str + strlen(str));
 
-                    cJSON_appendToDict(AS_DICT_PTR(GS_TOP(ObjectStack)), activeKey, genericStrObj);
+    // Delete partially parsed structure, arena allocated structures are released with the context
+    if ((result != cJSON_Ok) && !ctx->useArena)
+    {
+        cJSON_delGenObj(*GObjPtr);
+    }
+    if (result != cJSON_Ok)
+    {
+        GObjPtr->type = NullType;
+        GObjPtr->dataContainer = NULL;
+    }
 
-                    pFlags = CJP_DICT_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
-                }
-                else if (pFlags & CJP_LIST_VALUE_POSSIBLE)
-                {
-                    // String is a dictionary value, extract string to generic object's data container
-                    genericStrObj = mallocGenObj(String);
-                    strBuilderResult = cJSON_Parser_StringBuilder(&str, (char**)(&(genericStrObj.dataContainer)));
+    return result;
+}
 
-                    cJSON_appendToList(AS_LIST_PTR(GS_TOP(ObjectStack)), genericStrObj);
+cJSON_Result_t cJSON_parseWithSpans(cJSON_SpanDoc_t *doc, const char *str)
+{
+    cJSON_ParseContext_t ctx = cJSON_createParseContext(false);
+    cJSON_SpanTable_t spans = SPAN_Create();
 
-                    pFlags = CJP_LIST_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
-                }
-                else
-                {
-                    // String at invalid location detected, delete object stack and return error
-                    GS_Delete(&ObjectStack);
-                    return cJSON_Structure_Error;
-                }
+    ctx.spans = &spans;
+    ctx.spanBase = str;
 
-                // Check if StringBuilder was successful
-                if (strBuilderResult != cJSON_Ok)
-                {
-                    // StringBuilder exited unsuccessfully, delete object stack and return error
-                    GS_Delete(&ObjectStack);
-                    return strBuilderResult;
-                }
-                break;
-            case '-':
-            case '0':
-            case '1':
-            case '2':
-            case '3':
-            case '4':
-            case '5':
-            case '6':
-            case '7':
-            case '8':
-            case '9':
-                // Check if number is possible
-                if (pFlags & CJP_DICT_VALUE_POSSIBLE)
-                {
-                    cJSON_appendToDict(AS_DICT_PTR(GS_TOP(ObjectStack)), activeKey, cJSON_Parser_NumParser(&str));
+    cJSON_Result_t result = cJSON_parseStrWithContext(&ctx, &doc->root, str);
 
-                    pFlags = CJP_DICT_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
-                }
-                else if (pFlags & CJP_LIST_VALUE_POSSIBLE)
-                {
-                    // Top item in stack is a list, add null to list
-                    cJSON_appendToList(AS_LIST_PTR(GS_TOP(ObjectStack)), cJSON_Parser_NumParser(&str));
+    cJSON_deleteParseContext(&ctx);
 
-                    pFlags = CJP_LIST_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
-                }
-                else
-                {
-                    // Number at invalid location in structure, delete object stack and return error
-                    GS_Delete(&ObjectStack);
-                    return cJSON_Structure_Error;
-                }
-                break;
-            case 't':;
-            case 'f':;
-                // Check if boolean is possible
-                bool boolVal;
-                cJSON_Generic_t boolObj;
-
-                if ((LOWER_CASE_CHAR(*str) == 't')
-                 && (LOWER_CASE_CHAR(*(str + 1)) == 'r')
-                 && (LOWER_CASE_CHAR(*(str + 2)) == 'u')
-                 && (LOWER_CASE_CHAR(*(str + 3)) == 'e'))
-                {
-                    // Bool value is "true", skip "true" character sequence, store result
-                    str += 3;
-                    boolVal = true;
-                }
-                else if ((LOWER_CASE_CHAR(*str) == 'f')
-                      && (LOWER_CASE_CHAR(*(str + 1)) == 'a')
-                      && (LOWER_CASE_CHAR(*(str + 2)) == 'l')
-                      && (LOWER_CASE_CHAR(*(str + 3)) == 's')
-                      && (LOWER_CASE_CHAR(*(str + 4)) == 'e'))
-                {
-                    // Bool value is "false", skip "false" character sequence, store result
-                    str += 4;
-                    boolVal = false;
-                }
-                else
-                {
-                    // Invalid character sequence, delete object stack and return error
-                    GS_Delete(&ObjectStack);
-                    return cJSON_InvalidCharacterSequence_Error;
-                }
+    if (result != cJSON_Ok)
+    {
+        SPAN_Delete(&spans);
+        return result;
+    }
 
-                // Create generic object from boolean
-                boolObj = mallocGenObj(Boolean);
-                AS_BOOL(boolObj) = boolVal;
+    doc->spans = spans;
+    return cJSON_Ok;
+}
+cJSON_Result_t cJSON_reparse(cJSON_SpanDoc_t *doc, const char *oldText, const char *newText, cJSON_Edit_t edit)
+{
+    // Edits that don't change the text need no work
+    if ((edit.oldLength == edit.newLength) && !memcmp(oldText + edit.offset, newText + edit.offset, edit.newLength)) return cJSON_Ok;
 
-                // Valid character sequence
-                if (pFlags & CJP_DICT_VALUE_POSSIBLE)
-                {
-                    cJSON_appendToDict(AS_DICT_PTR(GS_TOP(ObjectStack)), activeKey, boolObj);
+    size_t index = SPAN_FindEnclosing(&doc->spans, edit.offset, edit.oldLength);
 
-                    pFlags = CJP_DICT_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
-                }
-                else if (pFlags & CJP_LIST_VALUE_POSSIBLE)
-                {
-                    cJSON_appendToList(AS_LIST_PTR(GS_TOP(ObjectStack)), boolObj);
+    if (index != CJSON_SPAN_NO_PARENT)
+    {
+        cJSON_SourceSpan_t span = doc->spans.spans[index];
+        ptrdiff_t delta = (ptrdiff_t)edit.newLength - (ptrdiff_t)edit.oldLength;
+        const char *str = newText + span.start;
+        const char *endPtr = newText + span.end + delta;
 
-                    pFlags = CJP_LIST_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
-                }
-                else
-                {
-                    // Boolean at invalid location in structure, delete object stack, delete generic bool object and return error
-                    GS_Delete(&ObjectStack);
-                    cJSON_delGenObj(boolObj);
-                    return cJSON_Structure_Error;
-                }
-                break;
-            case 'n':
-                // Extract null, check if whole string matches
-                if ((LOWER_CASE_CHAR(*(str + 1)) == 'u') && (LOWER_CASE_CHAR(*(str + 2)) == 'l') && (LOWER_CASE_CHAR(*(str + 3)) == 'l'))
+        cJSON_ParseContext_t ctx = cJSON_createParseContext(false);
+        cJSON_SpanTable_t subSpans = SPAN_Create();
+        cJSON_Generic_t subObj;
+
+        ctx.spans = &subSpans;
+        ctx.spanBase = str;
+
+        // Reparse the enclosing container only, its brackets are untouched by the edit
+        cJSON_Result_t result = cJSON_Parser_ParseRange(&ctx, &subObj, &str, endPtr);
+        bool spliced = false;
+
+        // The container has to end exactly where it did before (shifted by the edit), otherwise the edit changed the structure around it
+        if ((result == cJSON_Ok) && (str == endPtr - 1) && (subObj.type == span.obj.type))
+        {
+            if (!SPAN_Splice(&doc->spans, index, &subSpans, delta))
+            {
+                result = cJSON_NotAllocated_Error;
+            }
+            else
+            {
+                // Swap contents, so the container keeps its identity and its parent needs no update. The old contents are deleted with subObj.
+                if (span.obj.type == Dictionary)
                 {
-                    // Skip null characters (3 + 1 at end of the while loop) (yes, 3 is correct)
-                    str += 3;
-
-                    if (pFlags & CJP_DICT_VALUE_POSSIBLE)
-                    {
-                        // Top item is a dictionary, add null to dictionary
-                        cJSON_appendToDict(AS_DICT_PTR(GS_TOP(ObjectStack)), activeKey, mallocGenObj(NullType));
-
-                        pFlags = CJP_DICT_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
-                    }
-                    else if (pFlags & CJP_LIST_VALUE_POSSIBLE)
-                    {
-                        // Top item in stack is a list, add null to list
-                        cJSON_appendToList(AS_LIST_PTR(GS_TOP(ObjectStack)), mallocGenObj(NullType));
-
-                        pFlags = CJP_LIST_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
-                    }
-                    else
-                    {
-                        // Null at invalid location in structure, delete object stack and return error
-                        GS_Delete(&ObjectStack);
-                        return cJSON_Structure_Error;
-                    }
+                    cJSON_Dict_t tempDict = *AS_DICT_PTR(span.obj);
+                    *AS_DICT_PTR(span.obj) = *AS_DICT_PTR(subObj);
+                    *AS_DICT_PTR(subObj) = tempDict;
                 }
                 else
                 {
-                    // Invalid character sequence, delete object stack and return error
-                    GS_Delete(&ObjectStack);
-                    return cJSON_InvalidCharacterSequence_Error;
+                    cJSON_List_t tempList = *AS_LIST_PTR(span.obj);
+                    *AS_LIST_PTR(span.obj) = *AS_LIST_PTR(subObj);
+                    *AS_LIST_PTR(subObj) = tempList;
                 }
-                break;
-            default:
-                // Unknown character at current location detected, delete object stack and return error
-                GS_Delete(&ObjectStack);
-                return cJSON_Structure_Error;
+
+                spliced = true;
             }
         }
 
-        // Handle next character
-        str++;
+        cJSON_delGenObj(subObj);
+        SPAN_Delete(&subSpans);
+        cJSON_deleteParseContext(&ctx);
+
+        if (spliced) return cJSON_Ok;
+        if (result == cJSON_NotAllocated_Error) return result;
     }
 
-    // Delete object stack
-    GS_Delete(&ObjectStack);
+    // The edit touches the root's brackets or the structure around the container, parse the whole text
+    cJSON_SpanDoc_t newDoc;
+    cJSON_Result_t result = cJSON_parseWithSpans(&newDoc, newText);
+    if (result != cJSON_Ok) return result;
+
+    cJSON_deleteSpanDoc(doc);
+    *doc = newDoc;
 
     return cJSON_Ok;
 }
+void cJSON_deleteSpanDoc(cJSON_SpanDoc_t *doc)
+{
+    cJSON_delGenObj(doc->root);
+    SPAN_Delete(&doc->spans);
+
+    doc->root.type = NullType;
+    doc->root.dataContainer = NULL;
+}
 
 #pragma endregion
 
@@ -497,9 +1390,11 @@ cJSON_Result_t cJSON_tryGetString(cJSON_Generic_t GObj, cJSON_String_t *str)
 {
     if (GObj.type == String)
     {
+        size_t length = AS_STRING_LENGTH(GObj);
+
         if (*str != NULL) free(*str);
-        *str = malloc(strlen(AS_STRING(GObj)) + 1);
-        strcpy(*str, AS_STRING(GObj));
+        *str = malloc(length + 1);
+        memcpy(*str, AS_STRING(GObj), length + 1);
         return cJSON_Ok;
     }
 
@@ -535,6 +1430,31 @@ cJSON_Result_t cJSON_tryGetBool(cJSON_Generic_t GObj, cJSON_Bool_t *boolVal)
 
     return cJSON_Datatype_Error;
 }
+cJSON_Result_t cJSON_tryGetDictValue(cJSON_Generic_t GObj, const cJSON_Key_t key, cJSON_Generic_t *valObj)
+{
+    cJSON_object_size_size_t index;
+
+    if (GObj.type != Dictionary)                                return cJSON_Datatype_Error;
+    if (!cJSON_findDictKey(AS_DICT_PTR(GObj), key, 0, &index))  return cJSON_NotFound_Error;
+
+    *valObj = AS_DICT_PTR(GObj)->valueData[index];
+    return cJSON_Ok;
+}
+cJSON_Result_t cJSON_tryGetListLength(cJSON_Generic_t GObj, cJSON_object_size_size_t *length)
+{
+    if (!IS_LIST_TYPE(GObj.type))   return cJSON_Datatype_Error;
+
+    *length = cJSON_getListLength(GObj);
+    return cJSON_Ok;
+}
+cJSON_Result_t cJSON_tryGetListItem(cJSON_Generic_t GObj, cJSON_object_size_size_t index, cJSON_Generic_t *item)
+{
+    if (!IS_LIST_TYPE(GObj.type))               return cJSON_Datatype_Error;
+    if (index >= cJSON_getListLength(GObj))     return cJSON_NotFound_Error;
+
+    *item = cJSON_getListItem(GObj, index);
+    return cJSON_Ok;
+}
 
 #pragma endregion
 
@@ -571,6 +1491,17 @@ cJSON_Result_t cJSON_tryGetStringPtr(cJSON_Generic_t GObj, cJSON_String_t *strPt
 
     return cJSON_Datatype_Error;
 }
+cJSON_Result_t cJSON_tryGetStringView(cJSON_Generic_t GObj, const char **strPtr, size_t *length)
+{
+    if (GObj.type == String)
+    {
+        *strPtr = AS_STRING(GObj);
+        *length = AS_STRING_LENGTH(GObj);
+        return cJSON_Ok;
+    }
+
+    return cJSON_Datatype_Error;
+}
 cJSON_Result_t cJSON_tryGetIntPtr(cJSON_Generic_t GObj, cJSON_Int_t **intValPtr)
 {
     if (GObj.type == Integer)
@@ -601,6 +1532,28 @@ cJSON_Result_t cJSON_tryGetBoolPtr(cJSON_Generic_t GObj, cJSON_Bool_t **boolValP
 
     return cJSON_Datatype_Error;
 }
+cJSON_Result_t cJSON_tryGetIntArrayPtr(cJSON_Generic_t GObj, cJSON_Int_t **dataPtr, cJSON_object_size_size_t *length)
+{
+    if (GObj.type == IntArray)
+    {
+        *dataPtr = AS_INT_ARRAY_PTR(GObj)->data;
+        *length = AS_INT_ARRAY_PTR(GObj)->length;
+        return cJSON_Ok;
+    }
+
+    return cJSON_Datatype_Error;
+}
+cJSON_Result_t cJSON_tryGetFloatArrayPtr(cJSON_Generic_t GObj, cJSON_Float_t **dataPtr, cJSON_object_size_size_t *length)
+{
+    if (GObj.type == FloatArray)
+    {
+        *dataPtr = AS_FLOAT_ARRAY_PTR(GObj)->data;
+        *length = AS_FLOAT_ARRAY_PTR(GObj)->length;
+        return cJSON_Ok;
+    }
+
+    return cJSON_Datatype_Error;
+}
 
 #pragma endregion
 
@@ -651,6 +1604,15 @@ cJSON_Result_t cJSON_getRelDepth(cJSON_Generic_t GObj, cJSON_depth_t *maxDepth,
             return cJSON_Ok;
         }
         else return cJSON_DepthOutOfRange_Error;
+    case IntArray:
+    case FloatArray:
+        // Packed arrays only hold numbers, one level deep like a list of numbers
+        if (startDepth < CJSON_MAX_DEPTH)
+        {
+            *maxDepth = MAX(*maxDepth, startDepth + 1);
+            return cJSON_Ok;
+        }
+        else return cJSON_DepthOutOfRange_Error;
     default:
         *maxDepth = MAX(*maxDepth, startDepth);
         return cJSON_Ok;
@@ -662,4 +1624,109 @@ cJSON_Result_t cJSON_getAbsDepth(cJSON_Generic_t GObj, cJSON_depth_t *maxDepth)
     return cJSON_getRelDepth(GObj, maxDepth, 0);
 }
 
+uint64_t cJSON_hash(cJSON_Generic_t GObj)
+{
+    // Type is part of every hash, so e.g. 1 and 1.0 or "" and null differ
+    uint64_t typeSeed = (uint64_t)GObj.type;
+
+    switch (GObj.type)
+    {
+    case Dictionary:;
+        // Sum of entry hashes is independent of the key order
+        uint64_t entrySum = 0;
+
+        for (cJSON_object_size_size_t i = 0; i < AS_DICT_PTR(GObj)->length; i++)
+        {
+            uint64_t keyHash = HASH_Bytes(AS_DICT_PTR(GObj)->keyData[i], cJSON_getDictKeyLength(AS_DICT_PTR(GObj), i), typeSeed);
+            entrySum += HASH_Mix(keyHash, cJSON_hash(AS_DICT_PTR(GObj)->valueData[i]));
+        }
+
+        return HASH_Mix(typeSeed ^ AS_DICT_PTR(GObj)->length, entrySum);
+    case List:
+    case IntArray:
+    case FloatArray:;
+        // Chained item hashes depend on the item order, packed arrays hash like the equivalent generic list
+        cJSON_object_size_size_t listLength = cJSON_getListLength(GObj);
+        uint64_t listHash = HASH_Mix((uint64_t)List, listLength);
+
+        for (cJSON_object_size_size_t i = 0; i < listLength; i++)
+        {
+            listHash = HASH_Mix(listHash, cJSON_hash(cJSON_getListItem(GObj, i)));
+        }
+
+        return listHash;
+    case String:
+        return HASH_Bytes(AS_STRING(GObj), AS_STRING_LENGTH(GObj), typeSeed);
+    case Integer:
+        return HASH_Mix(typeSeed, (uint64_t)(int64_t)AS_INT(GObj));
+    case Float:;
+        // Normalize negative zero, so values that compare equal hash equal
+        cJSON_Float_t floatVal = (AS_FLOAT(GObj) == 0) ? 0 : AS_FLOAT(GObj);
+        uint32_t floatBits;
+        memcpy(&floatBits, &floatVal, sizeof(floatBits));
+        return HASH_Mix(typeSeed, floatBits);
+    case Boolean:
+        return HASH_Mix(typeSeed, AS_BOOL(GObj) ? 1 : 0);
+    default:
+        return HASH_Mix(typeSeed, 0);
+    }
+}
+
+bool cJSON_equals(cJSON_Generic_t a, cJSON_Generic_t b)
+{
+    // Packed arrays equal generic lists holding the same numbers
+    if (IS_LIST_TYPE(a.type) && IS_LIST_TYPE(b.type) && ((a.type != List) || (b.type != List)))
+    {
+        cJSON_object_size_size_t length = cJSON_getListLength(a);
+        if (length != cJSON_getListLength(b)) return false;
+
+        for (cJSON_object_size_size_t i = 0; i < length; i++)
+        {
+            if (!cJSON_equals(cJSON_getListItem(a, i), cJSON_getListItem(b, i))) return false;
+        }
+
+        return true;
+    }
+
+    if (a.type != b.type) return false;
+    if (a.dataContainer == b.dataContainer) return true;
+
+    switch (a.type)
+    {
+    case Dictionary:
+        if (AS_DICT_PTR(a)->length != AS_DICT_PTR(b)->length) return false;
+
+        for (cJSON_object_size_size_t i = 0; i < AS_DICT_PTR(a)->length; i++)
+        {
+            cJSON_object_size_size_t bIndex;
+
+            // Same position is checked first, dictionaries built from similar input mostly share their key order
+            if (!cJSON_findDictKeyView(AS_DICT_PTR(b), AS_DICT_PTR(a)->keyData[i], cJSON_getDictKeyLength(AS_DICT_PTR(a), i), i, &bIndex)) return false;
+            if (!cJSON_equals(AS_DICT_PTR(a)->valueData[i], AS_DICT_PTR(b)->valueData[bIndex])) return false;
+        }
+
+        return true;
+    case List:
+        if (AS_LIST_PTR(a)->length != AS_LIST_PTR(b)->length) return false;
+
+        for (cJSON_object_size_size_t i = 0; i < AS_LIST_PTR(a)->length; i++)
+        {
+            if (!cJSON_equals(AS_LIST_PTR(a)->data[i], AS_LIST_PTR(b)->data[i])) return false;
+        }
+
+        return true;
+    case String:;
+        size_t length = AS_STRING_LENGTH(a);
+        return (length == AS_STRING_LENGTH(b)) && !memcmp(AS_STRING(a), AS_STRING(b), length);
+    case Integer:
+        return AS_INT(a) == AS_INT(b);
+    case Float:
+        return AS_FLOAT(a) == AS_FLOAT(b);
+    case Boolean:
+        return AS_BOOL(a) == AS_BOOL(b);
+    default:
+        return true;
+    }
+}
+
 #pragma endregion
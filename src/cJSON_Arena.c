@@ -0,0 +1,136 @@
+/**
+ * @file cJSON_Arena.c
+ * @author HeCoding180
+ * @brief cJSON library arena (bump allocator) source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../inc/cJSON_Arena.h"
+#include "../inc/cJSON_Util.h"
+
+//   ---   Macros   ---
+
+/**
+ * @brief   Rounds size up to the next multiple of CJSON_ARENA_ALIGN.
+ *
+ */
+#define ARENA_ALIGN_UP(size) (((size) + (CJSON_ARENA_ALIGN - 1)) & ~((size_t)CJSON_ARENA_ALIGN - 1))
+
+//   ---   Function Implementations   ---
+
+// - Arena Functions -
+#pragma region Arena Functions
+
+cJSON_Arena_t ARENA_Create(size_t blockSize)
+{
+    cJSON_Arena_t tempArena;
+
+    // Initialize with default values, blocks are allocated lazily
+    tempArena.head = NULL;
+    tempArena.current = NULL;
+    tempArena.blockSize = (blockSize > 0) ? blockSize : CJSON_ARENA_BLOCK_SIZE;
+
+    return tempArena;
+}
+void ARENA_Delete(cJSON_Arena_t *arena)
+{
+    cJSON_ArenaBlock_t *block = arena->head;
+
+    // Free all blocks of the chain
+    while (block != NULL)
+    {
+        cJSON_ArenaBlock_t *nextBlock = block->next;
+        free(block);
+        block = nextBlock;
+    }
+
+    arena->head = NULL;
+    arena->current = NULL;
+}
+void ARENA_Reset(cJSON_Arena_t *arena)
+{
+    // Mark all blocks as unused, keep their memory for reuse
+    for (cJSON_ArenaBlock_t *block = arena->head; block != NULL; block = block->next)
+    {
+        block->used = 0;
+    }
+
+    arena->current = arena->head;
+}
+
+void* ARENA_Alloc(cJSON_Arena_t *arena, size_t size)
+{
+    size = ARENA_ALIGN_UP(size);
+
+    // Serve from the current block or from blocks kept by a previous reset
+    while (arena->current != NULL)
+    {
+        if ((arena->current->size - arena->current->used) >= size)
+        {
+            void *allocPtr = &arena->current->data[arena->current->used];
+            arena->current->used += size;
+            return allocPtr;
+        }
+        else if ((arena->current->next != NULL) && (arena->current->next->used == 0) && (arena->current->next->size >= size))
+        {
+            arena->current = arena->current->next;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    // Allocate a new block, requests larger than the default block size get a dedicated block
+    size_t newBlockSize = MAX(size, arena->blockSize);
+    cJSON_ArenaBlock_t *newBlock = (cJSON_ArenaBlock_t*)malloc(sizeof(cJSON_ArenaBlock_t) + newBlockSize);
+    if (newBlock == NULL) return NULL;
+
+    newBlock->size = newBlockSize;
+    newBlock->used = size;
+
+    // Link the new block behind the current block, so previously kept blocks stay reachable
+    if (arena->current == NULL)
+    {
+        newBlock->next = arena->head;
+        arena->head = newBlock;
+    }
+    else
+    {
+        newBlock->next = arena->current->next;
+        arena->current->next = newBlock;
+    }
+    arena->current = newBlock;
+
+    return newBlock->data;
+}
+void* ARENA_Realloc(cJSON_Arena_t *arena, void *ptr, size_t oldSize, size_t newSize)
+{
+    if (ptr == NULL) return ARENA_Alloc(arena, newSize);
+
+    size_t alignedOldSize = ARENA_ALIGN_UP(oldSize);
+    size_t alignedNewSize = ARENA_ALIGN_UP(newSize);
+
+    // Extend in place if ptr is the most recent allocation of the current block
+    cJSON_ArenaBlock_t *block = arena->current;
+    if ((block != NULL)
+     && ((unsigned char*)ptr + alignedOldSize == &block->data[block->used])
+     && ((block->size - block->used + alignedOldSize) >= alignedNewSize))
+    {
+        block->used = block->used - alignedOldSize + alignedNewSize;
+        return ptr;
+    }
+
+    // Otherwise move the allocation, the old memory is released with the arena
+    void *newPtr = ARENA_Alloc(arena, newSize);
+    if (newPtr != NULL) memcpy(newPtr, ptr, MIN(oldSize, newSize));
+
+    return newPtr;
+}
+
+#pragma endregion
@@ -0,0 +1,380 @@
+/**
+ * @file cJSON_Binding.c
+ * @author HeCoding180
+ * @brief cJSON library binding source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include "../inc/cJSON_Binding.h"
+#include "../inc/cJSON_Hash.h"
+#include "../inc/cJSON_Parser_Util.h"
+#include "../inc/cJSON_Scanner.h"
+
+//   ---   Defines   ---
+
+/**
+ * @brief   Number of hash seeds tried per table size before the dispatch table is doubled.
+ *
+ */
+#define CJSON_BINDING_SEED_ATTEMPTS     64U
+
+/**
+ * @brief   Maximum number of slots of a dispatch table. Slots store a field index + 1 as uint16_t, so larger tables can't be addressed by their contents anyway.
+ *
+ */
+#define CJSON_BINDING_MAX_SLOTS         (UINT16_MAX + 1U)
+
+//   ---   Typedefs   ---
+
+/**
+ * @brief   State of a single cJSON_parseInto call.
+ *
+ */
+typedef struct cJSON_BindingState
+{
+    const char *str;
+    const char *endPtr;
+    cJSON_SDB_t strBuffer;
+    char numBuffer[CJSON_MAX_NUM_LEN + 1];
+} cJSON_BindingState_t;
+
+//   ---   Static Function Implementations   ---
+
+// - Binding Helper Functions -
+#pragma region Binding Helper Functions
+
+/**
+ * @brief   Tries to place every key of desc into its own slot of a table with slotCount slots using the given seed.
+ *
+ */
+static bool cJSON_Binding_TryFill(const cJSON_StructDesc_t *desc, uint16_t *slots, uint32_t slotCount, uint64_t seed)
+{
+    memset(slots, 0, slotCount * sizeof(uint16_t));
+
+    for (uint16_t i = 0; i < desc->fieldCount; i++)
+    {
+        uint32_t slot = (uint32_t)HASH_Bytes(desc->fields[i].key, strlen(desc->fields[i].key), seed) & (slotCount - 1);
+
+        if (slots[slot] != 0) return false;
+        slots[slot] = i + 1;
+    }
+
+    return true;
+}
+
+/**
+ * @brief   Checks if two fields of desc are bound to the same key. No seed can separate those, so the dispatch table could never be built.
+ *
+ */
+static bool cJSON_Binding_HasDuplicateKeys(const cJSON_StructDesc_t *desc)
+{
+    for (uint16_t i = 0; i < desc->fieldCount; i++)
+    {
+        for (uint16_t j = i + 1; j < desc->fieldCount; j++)
+        {
+            if (!strcmp(desc->fields[i].key, desc->fields[j].key)) return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief   Checks if a field is bound to the given key. Keys are compared by length and bytes, like cJSON_findDictKeyView, since JSON keys may contain escaped null characters.
+ *
+ */
+static inline bool cJSON_Binding_KeyEquals(const cJSON_FieldDesc_t *field, const char *key, size_t keyLen)
+{
+    return (strlen(field->key) == keyLen) && !memcmp(field->key, key, keyLen);
+}
+
+/**
+ * @brief   Returns the field descriptor bound to key, NULL if the key is unknown.
+ *
+ */
+static const cJSON_FieldDesc_t* cJSON_Binding_FindField(const cJSON_StructDesc_t *desc, const char *key, size_t keyLen)
+{
+    if (desc->slots != NULL)
+    {
+        // Perfect hash, a single candidate needs to be compared
+        uint16_t fieldIndex = desc->slots[(uint32_t)HASH_Bytes(key, keyLen, desc->seed) & desc->slotMask];
+
+        if ((fieldIndex != 0) && cJSON_Binding_KeyEquals(&desc->fields[fieldIndex - 1], key, keyLen))
+        {
+            return &desc->fields[fieldIndex - 1];
+        }
+
+        return NULL;
+    }
+
+    for (uint16_t i = 0; i < desc->fieldCount; i++)
+    {
+        if (cJSON_Binding_KeyEquals(&desc->fields[i], key, keyLen)) return &desc->fields[i];
+    }
+
+    return NULL;
+}
+
+static cJSON_Result_t cJSON_Binding_ParseObject(cJSON_BindingState_t *state, const cJSON_StructDesc_t *desc, void *structPtr, size_t depth);
+
+/**
+ * @brief   Parses a value into the struct member described by field. state->str points to the first character of the value and is left behind it.
+ *
+ */
+static cJSON_Result_t cJSON_Binding_ParseField(cJSON_BindingState_t *state, const cJSON_FieldDesc_t *field, void *structPtr, size_t depth)
+{
+    const char *endPtr = state->endPtr;
+    char *memberPtr = (char*)structPtr + field->offset;
+    cJSON_Result_t result;
+
+    if (state->str >= endPtr) return cJSON_Structure_Error;
+
+    // null leaves the member untouched
+    if (cJSON_Parser_MatchLiteral(state->str, endPtr, "null", 4))
+    {
+        state->str += 4;
+        return cJSON_Ok;
+    }
+
+    switch (field->type)
+    {
+    case cJSON_IntField:
+    case cJSON_FloatField:;
+        bool numIsFloat = false;
+        size_t numStrLen = cJSON_Parser_ScanNumber(state->str, endPtr, &numIsFloat);
+
+        if ((*state->str != '-') && ((*state->str < '0') || (*state->str > '9')))   return cJSON_Datatype_Error;
+        if ((numStrLen == 0) || (numStrLen > CJSON_MAX_NUM_LEN))                     return cJSON_InvalidCharacterSequence_Error;
+        if (numIsFloat && (field->type == cJSON_IntField))                           return cJSON_Datatype_Error;
+
+        // Copy string of number to scratch buffer, so it can be null terminated
+        memcpy(state->numBuffer, state->str, numStrLen);
+        state->numBuffer[numStrLen] = '\0';
+
+        if (field->type == cJSON_IntField)  *(cJSON_Int_t*)memberPtr = (cJSON_Int_t)strtol(state->numBuffer, NULL, 10);
+        else                                *(cJSON_Float_t*)memberPtr = (cJSON_Float_t)strtod(state->numBuffer, NULL);
+
+        state->str += numStrLen;
+        return cJSON_Ok;
+    case cJSON_BoolField:
+        if (cJSON_Parser_MatchLiteral(state->str, endPtr, "true", 4))
+        {
+            *(cJSON_Bool_t*)memberPtr = true;
+            state->str += 4;
+        }
+        else if (cJSON_Parser_MatchLiteral(state->str, endPtr, "false", 5))
+        {
+            *(cJSON_Bool_t*)memberPtr = false;
+            state->str += 5;
+        }
+        else
+        {
+            return cJSON_Datatype_Error;
+        }
+
+        return cJSON_Ok;
+    case cJSON_StringField:
+    case cJSON_CharArrayField:
+        if (*state->str != '"') return cJSON_Datatype_Error;
+
+        result = cJSON_Parser_StringBuilder(&state->str, endPtr, &state->strBuffer);
+        if (result != cJSON_Ok) return result;
+
+        if (field->type == cJSON_StringField)
+        {
+            char *strCopy = (char*)malloc(state->strBuffer.bufferSize + 1);
+            if (strCopy == NULL) return cJSON_NotAllocated_Error;
+
+            memcpy(strCopy, SDB_GetStr(&state->strBuffer), state->strBuffer.bufferSize + 1);
+
+            // Replace string of a duplicate key
+            free(*(char**)memberPtr);
+            *(char**)memberPtr = strCopy;
+        }
+        else
+        {
+            if (state->strBuffer.bufferSize + 1 > field->size) return cJSON_LimitExceeded_Error;
+
+            memcpy(memberPtr, SDB_GetStr(&state->strBuffer), state->strBuffer.bufferSize + 1);
+        }
+
+        state->str++;
+        return cJSON_Ok;
+    case cJSON_ObjectField:
+        if (*state->str != '{') return cJSON_Datatype_Error;
+
+        return cJSON_Binding_ParseObject(state, field->nested, memberPtr, depth + 1);
+    default:
+        return cJSON_Datatype_Error;
+    }
+}
+
+/**
+ * @brief   Parses a dictionary into the struct described by desc. state->str points to the opening brace and is left behind the closing brace.
+ *
+ */
+static cJSON_Result_t cJSON_Binding_ParseObject(cJSON_BindingState_t *state, const cJSON_StructDesc_t *desc, void *structPtr, size_t depth)
+{
+    const char *endPtr = state->endPtr;
+    cJSON_Result_t result;
+
+    if (depth >= CJSON_MAX_DEPTH) return cJSON_DepthOutOfRange_Error;
+
+    state->str = SCAN_SkipWhitespace(state->str + 1, endPtr);
+    if ((state->str < endPtr) && (*state->str == '}'))
+    {
+        state->str++;
+        return cJSON_Ok;
+    }
+
+    while (true)
+    {
+        // Key
+        if ((state->str >= endPtr) || (*state->str != '"')) return cJSON_Structure_Error;
+
+        result = cJSON_Parser_StringBuilder(&state->str, endPtr, &state->strBuffer);
+        if (result != cJSON_Ok) return result;
+
+        const cJSON_FieldDesc_t *field = cJSON_Binding_FindField(desc, SDB_GetStr(&state->strBuffer), state->strBuffer.bufferSize);
+
+        // Key-value separator
+        state->str = SCAN_SkipWhitespace(state->str + 1, endPtr);
+        if ((state->str >= endPtr) || (*state->str != ':')) return cJSON_Structure_Error;
+        state->str = SCAN_SkipWhitespace(state->str + 1, endPtr);
+
+        // Value
+        if (field != NULL)
+        {
+            result = cJSON_Binding_ParseField(state, field, structPtr, depth);
+        }
+        else
+        {
+            // Unknown key, skip its value
+            result = cJSON_Parser_SkipValue(&state->str, endPtr, depth + 1);
+            state->str++;
+        }
+        if (result != cJSON_Ok) return result;
+
+        // Item separator or end of dictionary
+        state->str = SCAN_SkipWhitespace(state->str, endPtr);
+        if (state->str >= endPtr) return cJSON_Structure_Error;
+
+        if (*state->str == '}')
+        {
+            state->str++;
+            return cJSON_Ok;
+        }
+        if (*state->str != ',') return cJSON_Structure_Error;
+
+        state->str = SCAN_SkipWhitespace(state->str + 1, endPtr);
+    }
+}
+
+#pragma endregion
+
+//   ---   Function Implementations   ---
+
+// - Binding Functions -
+#pragma region Binding Functions
+
+cJSON_Result_t cJSON_compileStructDesc(cJSON_StructDesc_t *desc)
+{
+    uint32_t slotCount = 4;
+
+    if (desc->slots != NULL) return cJSON_Ok;
+
+    if (cJSON_Binding_HasDuplicateKeys(desc)) return cJSON_DuplicateKey_Error;
+
+    while ((slotCount < 2U * desc->fieldCount) && (slotCount < CJSON_BINDING_MAX_SLOTS)) slotCount *= 2;
+
+    // Search a collision free seed, grow the table if none is found
+    while (desc->slots == NULL)
+    {
+        if (slotCount > CJSON_BINDING_MAX_SLOTS) return cJSON_LimitExceeded_Error;
+
+        uint16_t *slots = (uint16_t*)malloc(slotCount * sizeof(uint16_t));
+        if (slots == NULL) return cJSON_NotAllocated_Error;
+
+        for (uint64_t seed = 1; seed <= CJSON_BINDING_SEED_ATTEMPTS; seed++)
+        {
+            if (cJSON_Binding_TryFill(desc, slots, slotCount, seed))
+            {
+                desc->seed = seed;
+                desc->slotMask = slotCount - 1;
+                desc->slots = slots;
+                break;
+            }
+        }
+
+        if (desc->slots == NULL)
+        {
+            free(slots);
+            slotCount *= 2;
+        }
+    }
+
+    for (uint16_t i = 0; i < desc->fieldCount; i++)
+    {
+        if (desc->fields[i].type != cJSON_ObjectField) continue;
+
+        cJSON_Result_t result = cJSON_compileStructDesc(desc->fields[i].nested);
+        if (result != cJSON_Ok) return result;
+    }
+
+    return cJSON_Ok;
+}
+void cJSON_releaseStructDesc(cJSON_StructDesc_t *desc)
+{
+    if (desc->slots == NULL) return;
+
+    free(desc->slots);
+    desc->slots = NULL;
+
+    for (uint16_t i = 0; i < desc->fieldCount; i++)
+    {
+        if (desc->fields[i].type == cJSON_ObjectField) cJSON_releaseStructDesc(desc->fields[i].nested);
+    }
+}
+
+cJSON_Result_t cJSON_parseInto(const cJSON_StructDesc_t *desc, void *structPtr, const char *ptr, size_t len)
+{
+    cJSON_BindingState_t state = {0};
+    cJSON_Result_t result;
+
+    state.str = ptr;
+    state.endPtr = ptr + len;
+
+    // Root structure, only whitespace may precede it
+    state.str = SCAN_SkipWhitespace(state.str, state.endPtr);
+
+    if ((state.str < state.endPtr) && (*state.str == '{'))  result = cJSON_Binding_ParseObject(&state, desc, structPtr, 0);
+    else                                                    result = cJSON_Structure_Error;
+
+    // Only whitespace may follow the root structure
+    if ((result == cJSON_Ok) && (SCAN_SkipWhitespace(state.str, state.endPtr) != state.endPtr)) result = cJSON_Structure_Error;
+
+    SDB_Free(&state.strBuffer);
+
+    return result;
+}
+void cJSON_freeInto(const cJSON_StructDesc_t *desc, void *structPtr)
+{
+    for (uint16_t i = 0; i < desc->fieldCount; i++)
+    {
+        char *memberPtr = (char*)structPtr + desc->fields[i].offset;
+
+        if (desc->fields[i].type == cJSON_StringField)
+        {
+            free(*(char**)memberPtr);
+            *(char**)memberPtr = NULL;
+        }
+        else if (desc->fields[i].type == cJSON_ObjectField)
+        {
+            cJSON_freeInto(desc->fields[i].nested, memberPtr);
+        }
+    }
+}
+
+#pragma endregion
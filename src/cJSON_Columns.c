@@ -0,0 +1,151 @@
+/**
+ * @file cJSON_Columns.c
+ * @author HeCoding180
+ * @brief cJSON library columns source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../inc/cJSON_Columns.h"
+#include "../inc/cJSON_Util.h"
+
+//   ---   Static Function Implementations   ---
+
+// - Column Helper Functions -
+#pragma region Column Helper Functions
+
+/**
+ * @brief   Returns the size of a column value in bytes.
+ *
+ */
+static size_t cJSON_Columns_ValueSize(cJSON_ColumnType_t type)
+{
+    switch (type)
+    {
+    case cJSON_IntColumn:       return sizeof(cJSON_Int_t);
+    case cJSON_FloatColumn:     return sizeof(cJSON_Float_t);
+    case cJSON_BoolColumn:      return sizeof(cJSON_Bool_t);
+    default:                    return sizeof(const char*);
+    }
+}
+
+/**
+ * @brief   Stores a value in a column's cell. Returns false if the value's type does not fit the column.
+ *
+ */
+static bool cJSON_Columns_Store(cJSON_Column_t *column, size_t row, cJSON_Generic_t value)
+{
+    if (value.dataContainer == NULL) return false;
+
+    switch (column->type)
+    {
+    case cJSON_IntColumn:
+        if (value.type != Integer) return false;
+        ((cJSON_Int_t*)column->data)[row] = AS_INT(value);
+        return true;
+    case cJSON_FloatColumn:
+        if      (value.type == Float)   ((cJSON_Float_t*)column->data)[row] = AS_FLOAT(value);
+        else if (value.type == Integer) ((cJSON_Float_t*)column->data)[row] = (cJSON_Float_t)AS_INT(value);
+        else                            return false;
+        return true;
+    case cJSON_BoolColumn:
+        if (value.type != Boolean) return false;
+        ((cJSON_Bool_t*)column->data)[row] = AS_BOOL(value);
+        return true;
+    case cJSON_StringColumn:
+        if (value.type != String) return false;
+        ((const char**)column->data)[row] = AS_STRING(value);
+        return true;
+    default:
+        return false;
+    }
+}
+
+#pragma endregion
+
+//   ---   Function Implementations   ---
+
+// - Column Functions -
+#pragma region Column Functions
+
+cJSON_Result_t cJSON_extractColumns(cJSON_Generic_t list, const char *const keys[], size_t nkeys, cJSON_Column_t *outColumns)
+{
+    if (list.type != List) return cJSON_Datatype_Error;
+
+    size_t rows = AS_LIST_PTR(list)->length;
+
+    // Per key state: key length and the slot the key was found at in the previous record
+    size_t *keyLengths = (size_t*)malloc(nkeys * sizeof(size_t));
+    cJSON_object_size_size_t *slotHints = (cJSON_object_size_size_t*)calloc(nkeys, sizeof(cJSON_object_size_size_t));
+    bool allocated = (nkeys == 0) || ((keyLengths != NULL) && (slotHints != NULL));
+
+    for (size_t k = 0; k < nkeys; k++)
+    {
+        outColumns[k].data = NULL;
+        outColumns[k].validity = NULL;
+        outColumns[k].length = rows;
+        outColumns[k].invalidCount = 0;
+
+        if (!allocated || (rows == 0)) continue;
+
+        keyLengths[k] = strlen(keys[k]);
+
+        outColumns[k].data = calloc(rows, cJSON_Columns_ValueSize(outColumns[k].type));
+        outColumns[k].validity = (uint8_t*)calloc((rows + 7) / 8, sizeof(uint8_t));
+        allocated = (outColumns[k].data != NULL) && (outColumns[k].validity != NULL);
+    }
+
+    if (!allocated)
+    {
+        free(keyLengths);
+        free(slotHints);
+        cJSON_deleteColumns(outColumns, nkeys);
+        return cJSON_NotAllocated_Error;
+    }
+
+    // Row major pass, every record is visited once for all columns
+    for (size_t row = 0; row < rows; row++)
+    {
+        cJSON_Generic_t record = AS_LIST_PTR(list)->data[row];
+
+        for (size_t k = 0; k < nkeys; k++)
+        {
+            cJSON_Column_t *column = &outColumns[k];
+            cJSON_object_size_size_t index;
+
+            bool valid = (record.type == Dictionary) && (record.dataContainer != NULL)
+                      && cJSON_findDictKeyView(AS_DICT_PTR(record), keys[k], keyLengths[k], slotHints[k], &index);
+
+            if (valid)
+            {
+                slotHints[k] = index;
+                valid = cJSON_Columns_Store(column, row, AS_DICT_PTR(record)->valueData[index]);
+            }
+
+            if (valid)  column->validity[row >> 3] |= (uint8_t)(1U << (row & 7U));
+            else        column->invalidCount++;
+        }
+    }
+
+    free(keyLengths);
+    free(slotHints);
+
+    return cJSON_Ok;
+}
+void cJSON_deleteColumns(cJSON_Column_t *columns, size_t nColumns)
+{
+    for (size_t i = 0; i < nColumns; i++)
+    {
+        free(columns[i].data);
+        free(columns[i].validity);
+
+        columns[i].data = NULL;
+        columns[i].validity = NULL;
+    }
+}
+
+#pragma endregion
@@ -0,0 +1,95 @@
+/**
+ * @file cJSON_Doc.c
+ * @author HeCoding180
+ * @brief cJSON library document source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include "../inc/cJSON.h"
+#include "../inc/cJSON_Doc.h"
+#include "../inc/cJSON_Util.h"
+
+//   ---   Static Function Implementations   ---
+
+// - Document Helper Functions -
+#pragma region Document Helper Functions
+
+/**
+ * @brief   Builds the sorted key tables or key indexes of all sufficiently large dictionaries of a tree.
+ *
+ */
+static void cJSON_Doc_BuildIndexes(cJSON_Arena_t *arena, cJSON_Generic_t GObj)
+{
+    if (GObj.dataContainer == NULL) return;
+
+    if (GObj.type == Dictionary)
+    {
+        cJSON_Dict_t *dictPtr = AS_DICT_PTR(GObj);
+
+        // Mid-sized dictionaries are searched using a sorted key table, only large ones get a hash index
+        if (dictPtr->length >= CJSON_DICT_INDEX_MIN_LENGTH)        cJSON_buildDictIndex(arena, dictPtr);
+        else if (dictPtr->length >= CJSON_DICT_SORT_MIN_LENGTH)    cJSON_buildDictSortedKeys(arena, dictPtr);
+
+        for (cJSON_object_size_size_t i = 0; i < dictPtr->length; i++) cJSON_Doc_BuildIndexes(arena, dictPtr->valueData[i]);
+    }
+    else if (GObj.type == List)
+    {
+        for (cJSON_object_size_size_t i = 0; i < AS_LIST_PTR(GObj)->length; i++) cJSON_Doc_BuildIndexes(arena, AS_LIST_PTR(GObj)->data[i]);
+    }
+}
+
+#pragma endregion
+
+//   ---   Function Implementations   ---
+
+// - Document Functions -
+#pragma region Document Functions
+
+cJSON_Result_t cJSON_freeze(cJSON_Generic_t GObj, cJSON_Doc_t **docPtr)
+{
+    cJSON_Doc_t *doc = (cJSON_Doc_t*)malloc(sizeof(cJSON_Doc_t));
+    if (doc == NULL) return cJSON_NotAllocated_Error;
+
+    // Minimal block size, every allocation (the clone and each key index) gets a block of exactly its size
+    doc->arena = ARENA_Create(CJSON_ARENA_ALIGN);
+
+    // Compact copy, the tree ends up in a single dedicated block
+    cJSON_CloneOptions_t cloneOpts = { .arena = &doc->arena };
+    if (cJSON_clone(GObj, &doc->root, &cloneOpts) != cJSON_Ok)
+    {
+        ARENA_Delete(&doc->arena);
+        free(doc);
+        return cJSON_NotAllocated_Error;
+    }
+
+    cJSON_Doc_BuildIndexes(&doc->arena, doc->root);
+
+    atomic_init(&doc->refCount, 1);
+
+    *docPtr = doc;
+    return cJSON_Ok;
+}
+cJSON_Doc_t* cJSON_docRetain(cJSON_Doc_t *doc)
+{
+    // The caller already holds a reference, no ordering needed
+    atomic_fetch_add_explicit(&doc->refCount, 1, memory_order_relaxed);
+
+    return doc;
+}
+void cJSON_docRelease(cJSON_Doc_t *doc)
+{
+    // Release ordering publishes this thread's reads before the free, acquire on the last reference sees all of them
+    if (atomic_fetch_sub_explicit(&doc->refCount, 1, memory_order_acq_rel) == 1)
+    {
+        ARENA_Delete(&doc->arena);
+        free(doc);
+    }
+}
+cJSON_Generic_t cJSON_docRoot(const cJSON_Doc_t *doc)
+{
+    return doc->root;
+}
+
+#pragma endregion
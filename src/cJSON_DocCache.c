@@ -0,0 +1,349 @@
+/**
+ * @file cJSON_DocCache.c
+ * @author HeCoding180
+ * @brief cJSON library document cache source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../inc/cJSON.h"
+#include "../inc/cJSON_DocCache.h"
+#include "../inc/cJSON_Hash.h"
+
+//   ---   Defines   ---
+
+/**
+ * @brief   Initial number of slots of a shard's table. The table doubles whenever it would become more than half full.
+ *
+ */
+#define CJSON_DOC_CACHE_INIT_SLOTS      16U
+
+/**
+ * @brief   Marks a slot that isn't found.
+ *
+ */
+#define CJSON_DOC_CACHE_NO_SLOT         SIZE_MAX
+
+//   ---   Static Function Implementations   ---
+
+// - Document Cache Helper Functions -
+#pragma region Document Cache Helper Functions
+
+/**
+ * @brief   Returns the shard responsible for a hash. The shard is chosen using the upper hash bits, the slot within the shard using the lower ones.
+ *
+ */
+static cJSON_DocCacheShard_t* cJSON_DocCache_Shard(cJSON_DocCache_t *cache, uint64_t hash)
+{
+    return &cache->shards[(hash >> 59) & (CJSON_DOC_CACHE_SHARDS - 1)];
+}
+
+/**
+ * @brief   Returns the number of bytes accounted to a document.
+ *
+ */
+static size_t cJSON_DocCache_DocCost(const cJSON_Doc_t *doc)
+{
+    size_t cost = sizeof(cJSON_Doc_t);
+
+    for (const cJSON_ArenaBlock_t *block = doc->arena.head; block != NULL; block = block->next)
+    {
+        cost += sizeof(cJSON_ArenaBlock_t) + block->size;
+    }
+
+    return cost;
+}
+
+/**
+ * @brief   Returns the slot holding the given input, CJSON_DOC_CACHE_NO_SLOT if it isn't cached. Must be called with the shard locked.
+ *
+ */
+static size_t cJSON_DocCache_Find(const cJSON_DocCacheShard_t *shard, uint64_t hash, const char *str, size_t len)
+{
+    if (shard->slots == NULL) return CJSON_DOC_CACHE_NO_SLOT;
+
+    for (size_t i = hash & shard->slotMask; shard->slots[i].doc != NULL; i = (i + 1) & shard->slotMask)
+    {
+        const cJSON_DocCacheEntry_t *entry = &shard->slots[i];
+
+        // Hash collisions are ruled out by comparing the input itself
+        if ((entry->hash == hash) && (entry->srcLen == len) && !memcmp(entry->src, str, len)) return i;
+    }
+
+    return CJSON_DOC_CACHE_NO_SLOT;
+}
+
+/**
+ * @brief   Inserts an entry into a shard's table that is known to have a free slot.
+ *
+ */
+static void cJSON_DocCache_Place(cJSON_DocCacheShard_t *shard, cJSON_DocCacheEntry_t entry)
+{
+    size_t i = entry.hash & shard->slotMask;
+
+    while (shard->slots[i].doc != NULL) i = (i + 1) & shard->slotMask;
+
+    shard->slots[i] = entry;
+}
+
+/**
+ * @brief   Makes sure a shard's table has room for one more entry, doubles the table if needed.
+ *
+ */
+static bool cJSON_DocCache_Reserve(cJSON_DocCacheShard_t *shard)
+{
+    size_t slotCount = (shard->slots != NULL) ? (shard->slotMask + 1) : 0;
+
+    if (2 * (shard->length + 1) <= slotCount) return true;
+
+    size_t newSlotCount = (slotCount > 0) ? (2 * slotCount) : CJSON_DOC_CACHE_INIT_SLOTS;
+    cJSON_DocCacheEntry_t *oldSlots = shard->slots;
+
+    shard->slots = (cJSON_DocCacheEntry_t*)calloc(newSlotCount, sizeof(cJSON_DocCacheEntry_t));
+    if (shard->slots == NULL)
+    {
+        shard->slots = oldSlots;
+        return false;
+    }
+    shard->slotMask = newSlotCount - 1;
+    shard->hand = 0;
+
+    for (size_t i = 0; i < slotCount; i++)
+    {
+        if (oldSlots[i].doc != NULL) cJSON_DocCache_Place(shard, oldSlots[i]);
+    }
+
+    free(oldSlots);
+
+    return true;
+}
+
+/**
+ * @brief   Removes the entry in the given slot and drops the cache's reference on its document. Following entries of the probe sequence are shifted back, so no tombstones are needed.
+ *
+ */
+static void cJSON_DocCache_RemoveAt(cJSON_DocCacheShard_t *shard, size_t index)
+{
+    cJSON_DocCacheEntry_t *slots = shard->slots;
+    size_t j = index;
+
+    shard->usedBytes -= slots[index].cost;
+    shard->length--;
+
+    cJSON_docRelease(slots[index].doc);
+    free(slots[index].src);
+
+    while (true)
+    {
+        j = (j + 1) & shard->slotMask;
+        if (slots[j].doc == NULL) break;
+
+        // Entries whose home slot lies cyclically within (index, j] stay in place
+        size_t home = slots[j].hash & shard->slotMask;
+        bool stays = (index <= j) ? ((index < home) && (home <= j)) : ((index < home) || (home <= j));
+
+        if (!stays)
+        {
+            slots[index] = slots[j];
+            index = j;
+        }
+    }
+
+    slots[index].doc = NULL;
+}
+
+/**
+ * @brief   Evicts entries using CLOCK until the shard fits its budget. Entries referenced since the hand last passed them get a second chance.
+ *
+ */
+static void cJSON_DocCache_Evict(cJSON_DocCache_t *cache, cJSON_DocCacheShard_t *shard)
+{
+    while ((shard->usedBytes > shard->maxBytes) && (shard->length > 0))
+    {
+        cJSON_DocCacheEntry_t *entry = &shard->slots[shard->hand];
+
+        if (entry->doc == NULL)
+        {
+            shard->hand = (shard->hand + 1) & shard->slotMask;
+        }
+        else if (entry->referenced)
+        {
+            entry->referenced = false;
+            shard->hand = (shard->hand + 1) & shard->slotMask;
+        }
+        else
+        {
+            // The hand stays, the slot may have been refilled by the backward shift
+            cJSON_DocCache_RemoveAt(shard, shard->hand);
+            atomic_fetch_add_explicit(&cache->evictions, 1, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief   Parses and freezes a JSON string.
+ *
+ */
+static cJSON_Result_t cJSON_DocCache_Load(const char *str, cJSON_Doc_t **docPtr)
+{
+    // Arena backed parse, the tree is compacted into the document by cJSON_freeze anyway
+    cJSON_ParseContext_t ctx = cJSON_createParseContext(true);
+    cJSON_Generic_t GObj;
+
+    cJSON_Result_t result = cJSON_parseStrWithContext(&ctx, &GObj, str);
+    if (result == cJSON_Ok) result = cJSON_freeze(GObj, docPtr);
+
+    cJSON_deleteParseContext(&ctx);
+
+    return result;
+}
+
+#pragma endregion
+
+//   ---   Function Implementations   ---
+
+// - Document Cache Functions -
+#pragma region Document Cache Functions
+
+cJSON_DocCache_t* cJSON_createDocCache(size_t maxBytes)
+{
+    cJSON_DocCache_t *cache = (cJSON_DocCache_t*)malloc(sizeof(cJSON_DocCache_t));
+    if (cache == NULL) return NULL;
+
+    for (size_t i = 0; i < CJSON_DOC_CACHE_SHARDS; i++)
+    {
+        cJSON_DocCacheShard_t *shard = &cache->shards[i];
+
+        pthread_mutex_init(&shard->lock, NULL);
+        shard->slots = NULL;
+        shard->slotMask = 0;
+        shard->length = 0;
+        shard->hand = 0;
+        shard->usedBytes = 0;
+        shard->maxBytes = maxBytes / CJSON_DOC_CACHE_SHARDS;
+    }
+
+    atomic_init(&cache->hits, 0);
+    atomic_init(&cache->misses, 0);
+    atomic_init(&cache->evictions, 0);
+
+    return cache;
+}
+void cJSON_deleteDocCache(cJSON_DocCache_t *cache)
+{
+    for (size_t i = 0; i < CJSON_DOC_CACHE_SHARDS; i++)
+    {
+        cJSON_DocCacheShard_t *shard = &cache->shards[i];
+
+        for (size_t j = 0; (shard->slots != NULL) && (j <= shard->slotMask); j++)
+        {
+            if (shard->slots[j].doc == NULL) continue;
+
+            cJSON_docRelease(shard->slots[j].doc);
+            free(shard->slots[j].src);
+        }
+
+        free(shard->slots);
+        pthread_mutex_destroy(&shard->lock);
+    }
+
+    free(cache);
+}
+
+cJSON_Result_t cJSON_docCacheParse(cJSON_DocCache_t *cache, const char *str, cJSON_Doc_t **docPtr)
+{
+    size_t len = strlen(str);
+    uint64_t hash = HASH_Bytes(str, len, 0);
+    cJSON_DocCacheShard_t *shard = cJSON_DocCache_Shard(cache, hash);
+    size_t index;
+
+    // Lookup
+    pthread_mutex_lock(&shard->lock);
+    index = cJSON_DocCache_Find(shard, hash, str, len);
+    if (index != CJSON_DOC_CACHE_NO_SLOT)
+    {
+        shard->slots[index].referenced = true;
+        *docPtr = cJSON_docRetain(shard->slots[index].doc);
+        pthread_mutex_unlock(&shard->lock);
+
+        atomic_fetch_add_explicit(&cache->hits, 1, memory_order_relaxed);
+        return cJSON_Ok;
+    }
+    pthread_mutex_unlock(&shard->lock);
+
+    atomic_fetch_add_explicit(&cache->misses, 1, memory_order_relaxed);
+
+    // Parse without holding the lock, so other inputs of the shard aren't blocked
+    cJSON_Doc_t *doc;
+    cJSON_Result_t result = cJSON_DocCache_Load(str, &doc);
+    if (result != cJSON_Ok) return result;
+
+    cJSON_DocCacheEntry_t entry = { .hash = hash, .src = NULL, .srcLen = len, .doc = doc, .cost = len + 1 + cJSON_DocCache_DocCost(doc), .referenced = true };
+
+    // Documents larger than the shard's budget are handed out uncached
+    if (entry.cost > shard->maxBytes)
+    {
+        *docPtr = doc;
+        return cJSON_Ok;
+    }
+
+    pthread_mutex_lock(&shard->lock);
+
+    // Another thread may have inserted the same input in the meantime
+    index = cJSON_DocCache_Find(shard, hash, str, len);
+    if (index != CJSON_DOC_CACHE_NO_SLOT)
+    {
+        *docPtr = cJSON_docRetain(shard->slots[index].doc);
+        pthread_mutex_unlock(&shard->lock);
+
+        cJSON_docRelease(doc);
+        return cJSON_Ok;
+    }
+
+    entry.src = (char*)malloc(len + 1);
+    if ((entry.src == NULL) || !cJSON_DocCache_Reserve(shard))
+    {
+        // Caching is best effort, the document itself is valid
+        pthread_mutex_unlock(&shard->lock);
+
+        free(entry.src);
+        *docPtr = doc;
+        return cJSON_Ok;
+    }
+    memcpy(entry.src, str, len + 1);
+
+    // The cache keeps its own reference
+    *docPtr = cJSON_docRetain(doc);
+    cJSON_DocCache_Place(shard, entry);
+    shard->length++;
+    shard->usedBytes += entry.cost;
+
+    cJSON_DocCache_Evict(cache, shard);
+
+    pthread_mutex_unlock(&shard->lock);
+
+    return cJSON_Ok;
+}
+
+void cJSON_getDocCacheStats(cJSON_DocCache_t *cache, cJSON_DocCacheStats_t *stats)
+{
+    stats->hits = atomic_load_explicit(&cache->hits, memory_order_relaxed);
+    stats->misses = atomic_load_explicit(&cache->misses, memory_order_relaxed);
+    stats->evictions = atomic_load_explicit(&cache->evictions, memory_order_relaxed);
+    stats->entries = 0;
+    stats->usedBytes = 0;
+
+    for (size_t i = 0; i < CJSON_DOC_CACHE_SHARDS; i++)
+    {
+        pthread_mutex_lock(&cache->shards[i].lock);
+        stats->entries += cache->shards[i].length;
+        stats->usedBytes += cache->shards[i].usedBytes;
+        pthread_mutex_unlock(&cache->shards[i].lock);
+    }
+}
+
+#pragma endregion
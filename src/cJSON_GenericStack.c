@@ -7,6 +7,8 @@
  * 
  */
 
+#include <stdlib.h>
+
 #include "../inc/cJSON_GenericStack.h"
 
 //   ---   Function Implementations   ---
@@ -36,6 +38,12 @@ void GS_Delete(cJSON_GenericStack_t *TSptr)
     TSptr->index = 0;
     TSptr->isEmpty = true;
 }
+void GS_Clear(cJSON_GenericStack_t *TSptr)
+{
+    // Reset TS struct variables, keep stack memory
+    TSptr->index = 0;
+    TSptr->isEmpty = true;
+}
 
 cJSON_GenericStack_Result_t GS_Push(cJSON_GenericStack_t *TSptr, cJSON_Generic_t type)
 {
@@ -0,0 +1,144 @@
+/**
+ * @file cJSON_Hash.c
+ * @author HeCoding180
+ * @brief cJSON library hash source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include <string.h>
+
+#include "../inc/cJSON_Hash.h"
+
+//   ---   Macros   ---
+
+// - Hash Constants -
+#pragma region Hash Constants
+
+#define HASH_PRIME_0    0xa0761d6478bd642fULL
+#define HASH_PRIME_1    0xe7037ed1a0b428dbULL
+#define HASH_PRIME_2    0x8ebc6af09c88c6e3ULL
+#define HASH_PRIME_3    0x589965cc75374cc3ULL
+
+#pragma endregion
+
+//   ---   Static Function Implementations   ---
+
+// - Hash Helper Functions -
+#pragma region Hash Helper Functions
+
+/**
+ * @brief   Multiplies a and b to a 128 bit product and folds its halves into 64 bits.
+ *
+ */
+static uint64_t HASH_MulFold(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = (__uint128_t)a * b;
+    return (uint64_t)product ^ (uint64_t)(product >> 64);
+#else
+    uint64_t aLow = (uint32_t)a, aHigh = a >> 32;
+    uint64_t bLow = (uint32_t)b, bHigh = b >> 32;
+    uint64_t lowLow = aLow * bLow, lowHigh = aLow * bHigh, highLow = aHigh * bLow, highHigh = aHigh * bHigh;
+    uint64_t cross = (lowLow >> 32) + (uint32_t)lowHigh + highLow;
+    uint64_t productHigh = highHigh + (lowHigh >> 32) + (cross >> 32);
+    uint64_t productLow = (cross << 32) | (uint32_t)lowLow;
+    return productLow ^ productHigh;
+#endif
+}
+
+/**
+ * @brief   Unaligned little endian 64 bit read.
+ *
+ */
+static uint64_t HASH_Read64(const unsigned char *ptr)
+{
+    uint64_t value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+/**
+ * @brief   Unaligned little endian 32 bit read.
+ *
+ */
+static uint64_t HASH_Read32(const unsigned char *ptr)
+{
+    uint32_t value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+#pragma endregion
+
+//   ---   Function Implementations   ---
+
+// - Hash Functions -
+#pragma region Hash Functions
+
+uint64_t HASH_Bytes(const void *data, size_t len, uint64_t seed)
+{
+    const unsigned char *ptr = (const unsigned char*)data;
+    uint64_t a, b;
+
+    seed ^= HASH_MulFold(seed ^ HASH_PRIME_0, HASH_PRIME_1);
+
+    if (len <= 16)
+    {
+        // Short input, read overlapping words covering all bytes
+        if (len >= 4)
+        {
+            a = (HASH_Read32(ptr) << 32) | HASH_Read32(ptr + ((len >> 3) << 2));
+            b = (HASH_Read32(ptr + len - 4) << 32) | HASH_Read32(ptr + len - 4 - ((len >> 3) << 2));
+        }
+        else if (len > 0)
+        {
+            a = ((uint64_t)ptr[0] << 16) | ((uint64_t)ptr[len >> 1] << 8) | ptr[len - 1];
+            b = 0;
+        }
+        else
+        {
+            a = b = 0;
+        }
+    }
+    else
+    {
+        size_t remaining = len;
+
+        // Two independent lanes for long input
+        if (remaining > 48)
+        {
+            uint64_t seed1 = seed, seed2 = seed;
+
+            do
+            {
+                seed = HASH_MulFold(HASH_Read64(ptr) ^ HASH_PRIME_1, HASH_Read64(ptr + 8) ^ seed);
+                seed1 = HASH_MulFold(HASH_Read64(ptr + 16) ^ HASH_PRIME_2, HASH_Read64(ptr + 24) ^ seed1);
+                seed2 = HASH_MulFold(HASH_Read64(ptr + 32) ^ HASH_PRIME_3, HASH_Read64(ptr + 40) ^ seed2);
+                ptr += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+
+            seed ^= seed1 ^ seed2;
+        }
+
+        while (remaining > 16)
+        {
+            seed = HASH_MulFold(HASH_Read64(ptr) ^ HASH_PRIME_1, HASH_Read64(ptr + 8) ^ seed);
+            ptr += 16;
+            remaining -= 16;
+        }
+
+        // Last 16 bytes (overlapping with already processed bytes)
+        a = HASH_Read64(ptr + remaining - 16);
+        b = HASH_Read64(ptr + remaining - 8);
+    }
+
+    return HASH_MulFold(HASH_PRIME_1 ^ len, HASH_MulFold(a ^ HASH_PRIME_1, b ^ seed));
+}
+uint64_t HASH_Mix(uint64_t a, uint64_t b)
+{
+    return HASH_MulFold(a ^ HASH_PRIME_0, b ^ HASH_PRIME_1);
+}
+
+#pragma endregion
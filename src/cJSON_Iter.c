@@ -0,0 +1,318 @@
+/**
+ * @file cJSON_Iter.c
+ * @author HeCoding180
+ * @brief cJSON library iterator source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../inc/cJSON_Constants.h"
+#include "../inc/cJSON_Iter.h"
+#include "../inc/cJSON_Util.h"
+
+//   ---   Defines   ---
+
+#if defined(__GNUC__) || defined(__clang__)
+#define ITER_PREFETCH(ptr)  __builtin_prefetch(ptr)
+#else
+#define ITER_PREFETCH(ptr)  ((void)(ptr))
+#endif
+
+//   ---   Static Function Implementations   ---
+
+// - Iterator Helper Functions -
+#pragma region Iterator Helper Functions
+
+/**
+ * @brief   Makes sure an array can hold at least minCapacity items of itemSize bytes.
+ *
+ */
+static bool cJSON_Iter_Reserve(void **array, size_t *capacity, size_t minCapacity, size_t itemSize)
+{
+    if (minCapacity <= *capacity) return true;
+
+    size_t newCapacity = (*capacity > 0) ? *capacity : CJSON_CONTAINER_INIT_CAPACITY;
+    while (newCapacity < minCapacity) newCapacity *= 2;
+
+    void *newArray = realloc(*array, newCapacity * itemSize);
+    if (newArray == NULL) return false;
+
+    *array = newArray;
+    *capacity = newCapacity;
+
+    return true;
+}
+
+/**
+ * @brief   Checks if a value has children.
+ *
+ */
+static inline bool cJSON_Iter_IsContainer(cJSON_Generic_t GObj)
+{
+    return (GObj.type == Dictionary) || IS_LIST_TYPE(GObj.type);
+}
+
+/**
+ * @brief   Returns the number of children of a container.
+ *
+ */
+static inline cJSON_object_size_size_t cJSON_Iter_Length(cJSON_Generic_t container)
+{
+    if (container.dataContainer == NULL) return 0;
+
+    return (container.type == Dictionary) ? AS_DICT_PTR(container)->length : cJSON_getListLength(container);
+}
+
+/**
+ * @brief   Returns the child at the given index of a container.
+ *
+ */
+static inline cJSON_Generic_t cJSON_Iter_Child(cJSON_Generic_t container, cJSON_object_size_size_t index)
+{
+    if (container.type == Dictionary)   return AS_DICT_PTR(container)->valueData[index];
+    else if (container.type == List)    return AS_LIST_PTR(container)->data[index];
+    else                                return cJSON_getListItem(container, index);
+}
+
+/**
+ * @brief   Returns the key of the child at the given index of a container, NULL if the container isn't a dictionary.
+ *
+ */
+static inline const char* cJSON_Iter_Key(cJSON_Generic_t container, cJSON_object_size_size_t index)
+{
+    return (container.type == Dictionary) ? AS_DICT_PTR(container)->keyData[index] : NULL;
+}
+
+/**
+ * @brief   Prefetches the node of the child at the given index of a container, if there is one. Items of packed arrays are stored in place and need no prefetch.
+ *
+ */
+static inline void cJSON_Iter_Prefetch(cJSON_Generic_t container, cJSON_object_size_size_t index)
+{
+    if ((container.type == Dictionary) && (index < AS_DICT_PTR(container)->length))     ITER_PREFETCH(AS_DICT_PTR(container)->valueData[index].dataContainer);
+    else if ((container.type == List) && (index < AS_LIST_PTR(container)->length))      ITER_PREFETCH(AS_LIST_PTR(container)->data[index].dataContainer);
+}
+
+/**
+ * @brief   Moves the cursor to a value.
+ *
+ */
+static inline void cJSON_Iter_Visit(cJSON_Iter_t *iter, cJSON_Generic_t value, const char *key, cJSON_object_size_size_t index, size_t depth)
+{
+    iter->value = value;
+    iter->key = key;
+    iter->index = index;
+    iter->depth = depth;
+    iter->descend = cJSON_Iter_IsContainer(value);
+    iter->event = iter->descend ? cJSON_IterEnter : cJSON_IterValue;
+}
+
+/**
+ * @brief   Depth-first step of cJSON_iterNext. The frames on the stack are the ancestors of the current value, so the current depth always equals the number of frames.
+ *
+ */
+static cJSON_Result_t cJSON_Iter_NextDepthFirst(cJSON_Iter_t *iter)
+{
+    if (!iter->started)
+    {
+        iter->started = true;
+        cJSON_Iter_Visit(iter, iter->root, NULL, 0, 0);
+        return cJSON_Ok;
+    }
+
+    if (iter->event == cJSON_IterEnter)
+    {
+        if (!iter->descend)
+        {
+            // Skipped container, its leave event follows right away
+            iter->event = cJSON_IterLeave;
+            return cJSON_Ok;
+        }
+
+        if (!cJSON_Iter_Reserve((void**)&iter->frames, &iter->frameCapacity, iter->frameCount + 1, sizeof(cJSON_IterFrame_t))) return cJSON_NotAllocated_Error;
+
+        iter->frames[iter->frameCount].container = iter->value;
+        iter->frames[iter->frameCount].next = 0;
+        iter->frameCount++;
+
+        for (cJSON_object_size_size_t i = 1; i < CJSON_ITER_PREFETCH_DISTANCE; i++) cJSON_Iter_Prefetch(iter->value, i);
+    }
+
+    // Root left (or root isn't a container), traversal complete
+    if (iter->frameCount == 0) return cJSON_NotFound_Error;
+
+    cJSON_IterFrame_t *top = &iter->frames[iter->frameCount - 1];
+
+    if (top->next < cJSON_Iter_Length(top->container))
+    {
+        cJSON_object_size_size_t index = top->next++;
+
+        cJSON_Iter_Prefetch(top->container, index + CJSON_ITER_PREFETCH_DISTANCE);
+        cJSON_Iter_Visit(iter, cJSON_Iter_Child(top->container, index), cJSON_Iter_Key(top->container, index), index, iter->frameCount);
+    }
+    else
+    {
+        // All children visited, leave the container
+        iter->frameCount--;
+
+        iter->event = cJSON_IterLeave;
+        iter->value = top->container;
+        iter->depth = iter->frameCount;
+        iter->descend = false;
+
+        if (iter->frameCount > 0)
+        {
+            cJSON_IterFrame_t *parent = &iter->frames[iter->frameCount - 1];
+
+            iter->index = parent->next - 1;
+            iter->key = cJSON_Iter_Key(parent->container, iter->index);
+        }
+        else
+        {
+            iter->index = 0;
+            iter->key = NULL;
+        }
+    }
+
+    return cJSON_Ok;
+}
+
+/**
+ * @brief   Breadth-first step of cJSON_iterNext. The children of a container are queued when the cursor moves on from it, so skipping only has to clear the descend flag.
+ *
+ */
+static cJSON_Result_t cJSON_Iter_NextBreadthFirst(cJSON_Iter_t *iter)
+{
+    if (!iter->started)
+    {
+        if (!cJSON_Iter_Reserve((void**)&iter->queue, &iter->queueCapacity, 1, sizeof(cJSON_IterNode_t))) return cJSON_NotAllocated_Error;
+
+        iter->queue[0] = (cJSON_IterNode_t){ .value = iter->root, .parent = SIZE_MAX, .index = 0, .depth = 0 };
+        iter->queueLength = 1;
+        iter->started = true;
+    }
+    else if ((iter->event == cJSON_IterEnter) && iter->descend)
+    {
+        cJSON_object_size_size_t length = cJSON_Iter_Length(iter->value);
+
+        if (!cJSON_Iter_Reserve((void**)&iter->queue, &iter->queueCapacity, iter->queueLength + length, sizeof(cJSON_IterNode_t))) return cJSON_NotAllocated_Error;
+
+        for (cJSON_object_size_size_t i = 0; i < length; i++)
+        {
+            iter->queue[iter->queueLength++] = (cJSON_IterNode_t){ .value = cJSON_Iter_Child(iter->value, i), .parent = iter->queueHead - 1, .index = i, .depth = iter->depth + 1 };
+        }
+
+        iter->descend = false;
+    }
+
+    if (iter->queueHead == iter->queueLength) return cJSON_NotFound_Error;
+
+    const cJSON_IterNode_t *node = &iter->queue[iter->queueHead++];
+
+    if (iter->queueHead + CJSON_ITER_PREFETCH_DISTANCE - 1 < iter->queueLength) ITER_PREFETCH(iter->queue[iter->queueHead + CJSON_ITER_PREFETCH_DISTANCE - 1].value.dataContainer);
+
+    const char *key = (node->parent != SIZE_MAX) ? cJSON_Iter_Key(iter->queue[node->parent].value, node->index) : NULL;
+    cJSON_Iter_Visit(iter, node->value, key, node->index, node->depth);
+
+    return cJSON_Ok;
+}
+
+/**
+ * @brief   Appends the reference token of a container's child to path, character by character in reverse order (cJSON_iterPath builds the pointer from the current value up to the root and reverses it at the end).
+ *
+ */
+static void cJSON_Iter_PushTokenReversed(cJSON_SDB_t *path, cJSON_Generic_t container, cJSON_object_size_size_t index)
+{
+    if (container.type == Dictionary)
+    {
+        const char *key = AS_DICT_PTR(container)->keyData[index];
+
+        for (size_t i = strlen(key); i > 0; i--)
+        {
+            if (key[i - 1] == '~')          SDB_AddChars(path, "0~", 2);
+            else if (key[i - 1] == '/')     SDB_AddChars(path, "1~", 2);
+            else                            SDB_AddChar(path, key[i - 1]);
+        }
+    }
+    else
+    {
+        // Digits are produced least significant first, which already is reverse order
+        do
+        {
+            SDB_AddChar(path, (char)('0' + (index % 10)));
+            index /= 10;
+        } while (index > 0);
+    }
+
+    SDB_AddChar(path, '/');
+}
+
+#pragma endregion
+
+//   ---   Function Implementations   ---
+
+// - Iterator Functions -
+#pragma region Iterator Functions
+
+cJSON_Iter_t cJSON_createIter(cJSON_Generic_t root, cJSON_IterOrder_t order)
+{
+    cJSON_Iter_t tempIter = {0};
+
+    tempIter.order = order;
+    tempIter.root = root;
+
+    return tempIter;
+}
+void cJSON_deleteIter(cJSON_Iter_t *iter)
+{
+    free(iter->frames);
+    free(iter->queue);
+    SDB_Free(&iter->path);
+
+    *iter = cJSON_createIter(iter->root, iter->order);
+}
+
+cJSON_Result_t cJSON_iterNext(cJSON_Iter_t *iter)
+{
+    return (iter->order == cJSON_DepthFirst) ? cJSON_Iter_NextDepthFirst(iter) : cJSON_Iter_NextBreadthFirst(iter);
+}
+void cJSON_iterSkip(cJSON_Iter_t *iter)
+{
+    iter->descend = false;
+}
+const char* cJSON_iterPath(cJSON_Iter_t *iter)
+{
+    SDB_Reset(&iter->path);
+
+    if (iter->order == cJSON_DepthFirst)
+    {
+        for (size_t level = iter->frameCount; level > 0; level--)
+        {
+            cJSON_Iter_PushTokenReversed(&iter->path, iter->frames[level - 1].container, iter->frames[level - 1].next - 1);
+        }
+    }
+    else if (iter->queueHead > 0)
+    {
+        for (size_t i = iter->queueHead - 1; iter->queue[i].parent != SIZE_MAX; i = iter->queue[i].parent)
+        {
+            cJSON_Iter_PushTokenReversed(&iter->path, iter->queue[iter->queue[i].parent].value, iter->queue[i].index);
+        }
+    }
+
+    char *str = (char*)SDB_GetStr(&iter->path);
+
+    for (size_t i = 0, j = iter->path.bufferSize; i + 1 < j; i++, j--)
+    {
+        char tempChar = str[i];
+        str[i] = str[j - 1];
+        str[j - 1] = tempChar;
+    }
+
+    return str;
+}
+
+#pragma endregion
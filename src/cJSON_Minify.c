@@ -0,0 +1,39 @@
+/**
+ * @file cJSON_Minify.c
+ * @author HeCoding180
+ * @brief cJSON library minifier source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include "../inc/cJSON_Minify.h"
+#include "../inc/cJSON_Scanner.h"
+
+//   ---   Function Implementations   ---
+
+// - Minifier Functions -
+#pragma region Minifier Functions
+
+size_t cJSON_minify(char *buf, size_t len)
+{
+    cJSON_Minifier_t minifier;
+    cJSON_initMinifier(&minifier);
+
+    size_t newLen = cJSON_minifyChunk(&minifier, buf, len);
+    if (newLen < len) buf[newLen] = '\0';
+
+    return newLen;
+}
+
+void cJSON_initMinifier(cJSON_Minifier_t *minifier)
+{
+    minifier->inString = false;
+    minifier->escape = false;
+}
+size_t cJSON_minifyChunk(cJSON_Minifier_t *minifier, char *buf, size_t len)
+{
+    return SCAN_Minify(buf, len, &minifier->inString, &minifier->escape);
+}
+
+#pragma endregion
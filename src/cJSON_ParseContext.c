@@ -0,0 +1,50 @@
+/**
+ * @file cJSON_ParseContext.c
+ * @author HeCoding180
+ * @brief cJSON library parse context source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include "../inc/cJSON_ParseContext.h"
+
+//   ---   Function Implementations   ---
+
+// - Parse Context Functions -
+#pragma region Parse Context Functions
+
+cJSON_ParseContext_t cJSON_createParseContext(bool useArena)
+{
+    cJSON_ParseContext_t tempCtx = {0};
+
+    // Object stack is allocated once, scratch buffers grow on demand
+    tempCtx.objectStack = GS_Create(CJSON_MAX_DEPTH);
+    tempCtx.useArena = useArena;
+    tempCtx.arena = ARENA_Create(CJSON_ARENA_BLOCK_SIZE);
+
+    return tempCtx;
+}
+void cJSON_resetParseContext(cJSON_ParseContext_t *ctx)
+{
+    GS_Clear(&ctx->objectStack);
+    ctx->nodeCount = 0;
+    ctx->byteCount = 0;
+    SDB_Reset(&ctx->strBuffer);
+    SDB_Reset(&ctx->keyBuffer);
+    ARENA_Reset(&ctx->arena);
+}
+void cJSON_deleteParseContext(cJSON_ParseContext_t *ctx)
+{
+    GS_Delete(&ctx->objectStack);
+    SDB_Free(&ctx->strBuffer);
+    SDB_Free(&ctx->keyBuffer);
+    ARENA_Delete(&ctx->arena);
+}
+
+cJSON_Arena_t* cJSON_getParseContextArena(cJSON_ParseContext_t *ctx)
+{
+    return ctx->useArena ? &ctx->arena : NULL;
+}
+
+#pragma endregion
@@ -8,150 +8,499 @@
  */
 
 #include "../inc/cJSON_Parser_Util.h"
-#include "../inc/cJSON_StringDoubleBuffer.h"
+#include "../inc/cJSON_Scanner.h"
+#include "../inc/cJSON_Stats.h"
 
-//   ---   Function Implementations   ---
+//   ---   Static Function Implementations   ---
 
-// - StringBuilder Functon Implementations -
-#pragma region StringBuilder Functon Implementations
+// - StringBuilder Helper Functions -
+#pragma region StringBuilder Helper Functions
 
-cJSON_Result_t cJSON_Parser_StringBuilder(char **refStrPtr, char **outputStrPtr)
+/**
+ * @brief   String extraction loop of cJSON_Parser_StringBuilder.
+ * 
+ */
+static cJSON_Result_t cJSON_Parser_BuildString(const char **refStrPtr, const char *endPtr, cJSON_SDB_t *outBuf, size_t maxLength)
 {
-    cJSON_SDB_t outBuf = {0};
+    const char *str = *refStrPtr + 1;
 
-    bool inEscapeSequence = false;
+    // Discard contents of the previous string, keep buffer memory
+    SDB_Reset(outBuf);
 
-    int strBuilderCharNo = 0;
+    while (str < endPtr)
+    {
+        // Copy the run of plain characters up to the next quote, backslash or control character at once, validate its encoding on the way
+        const char *runEnd = SCAN_StringRun(str, endPtr);
+        size_t utf8ErrOffset;
 
-    char currentRefChar = *(*refStrPtr);
+        if (!SCAN_ValidateUTF8(str, (size_t)(runEnd - str), &utf8ErrOffset))
+        {
+            *refStrPtr = str + utf8ErrOffset;
+            return cJSON_InvalidCharacterSequence_Error;
+        }
 
-    // Loop through refStrPtr characters
-    while (*((*refStrPtr)++))
-    {
-        if (inEscapeSequence)
+        // Checked before copying, so an oversized string is never buffered
+        if ((size_t)(runEnd - str) > maxLength - outBuf->bufferSize)
+        {
+            *refStrPtr = str + (maxLength - outBuf->bufferSize);
+            return cJSON_LimitExceeded_Error;
+        }
+
+        SDB_AddChars(outBuf, str, (size_t)(runEnd - str));
+
+        str = runEnd;
+        if (str >= endPtr) break;
+
+        if (*str == '"')
+        {
+            // Exit string environment, formatted string is stored in outBuf
+            *refStrPtr = str;
+            return cJSON_Ok;
+        }
+        else if (*str == '\\')
         {
+            // Escape sequence
+            str++;
+            if (str >= endPtr) break;
+
             // Add character according to escape sequence
-            switch (**refStrPtr)
+            switch (*str)
             {
-            case 'N':
             case 'n':
-                SDB_AddChar(&outBuf, '\n');
+                SDB_AddChar(outBuf, '\n');
                 break;
-            case 'R':
             case 'r':
-                SDB_AddChar(&outBuf, '\r');
+                SDB_AddChar(outBuf, '\r');
                 break;
-            case 'T':
             case 't':
-                SDB_AddChar(&outBuf, '\t');
+                SDB_AddChar(outBuf, '\t');
                 break;
-            case '"':
-                SDB_AddChar(&outBuf, '"');
+            case 'b':
+                SDB_AddChar(outBuf, '\b');
+                break;
+            case 'f':
+                SDB_AddChar(outBuf, '\f');
                 break;
+            case '"':
             case '\\':
-                SDB_AddChar(&outBuf, '\\');
+            case '/':
+                SDB_AddChar(outBuf, *str);
                 break;
-            default:
-                // Add unknown escape sequence to string using plain text
-                SDB_AddChar(&outBuf, '\\');
-                SDB_AddChar(&outBuf, **refStrPtr);
+            case 'u':;
+                // Decode escaped code point (including surrogate pairs) to UTF-8
+                uint32_t codePoint;
+                char utf8Seq[4];
+
+                if (cJSON_Parser_ParseUnicodeEscape(&str, endPtr, &codePoint) != cJSON_Ok)
+                {
+                    *refStrPtr = str;
+                    return cJSON_InvalidCharacterSequence_Error;
+                }
+
+                SDB_AddChars(outBuf, utf8Seq, cJSON_Parser_EncodeUTF8(codePoint, utf8Seq));
                 break;
+            default:
+                // Unknown escape sequence
+                *refStrPtr = str;
+                return cJSON_InvalidCharacterSequence_Error;
+            }
+
+            if (outBuf->bufferSize > maxLength)
+            {
+                *refStrPtr = str;
+                return cJSON_LimitExceeded_Error;
             }
 
-            // End escape sequence
-            inEscapeSequence = false;
+            str++;
         }
-        else if (**refStrPtr == '"')
+        else
         {
-            // Exit string environment
+            // Unescaped control character
+            *refStrPtr = str;
+            return cJSON_InvalidCharacterSequence_Error;
+        }
+    }
+
+    // String terminator reached before string finished
+    *refStrPtr = endPtr;
+    return cJSON_Structure_Error;
+}
+
+#pragma endregion
+
+//   ---   Function Implementations   ---
+
+// - StringBuilder Functon Implementations -
+#pragma region StringBuilder Functon Implementations
+
+cJSON_Result_t cJSON_Parser_StringBuilder(const char **refStrPtr, const char *endPtr, cJSON_SDB_t *outBuf)
+{
+    return cJSON_Parser_BoundedStringBuilder(refStrPtr, endPtr, outBuf, SIZE_MAX);
+}
+cJSON_Result_t cJSON_Parser_BoundedStringBuilder(const char **refStrPtr, const char *endPtr, cJSON_SDB_t *outBuf, size_t maxLength)
+{
+    CJSON_STATS_BEGIN(cJSON_StringPhase, startTime);
+
+    cJSON_Result_t result = cJSON_Parser_BuildString(refStrPtr, endPtr, outBuf, maxLength);
+
+    CJSON_STATS_END(cJSON_StringPhase, startTime);
+
+    return result;
+}
+size_t cJSON_Parser_EncodeUTF8(uint32_t codePoint, char *outSeq)
+{
+    if (codePoint < 0x80)
+    {
+        outSeq[0] = (char)codePoint;
+        return 1;
+    }
+    else if (codePoint < 0x800)
+    {
+        outSeq[0] = (char)(0xC0 | (codePoint >> 6));
+        outSeq[1] = (char)(0x80 | (codePoint & 0x3F));
+        return 2;
+    }
+    else if (codePoint < 0x10000)
+    {
+        outSeq[0] = (char)(0xE0 | (codePoint >> 12));
+        outSeq[1] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        outSeq[2] = (char)(0x80 | (codePoint & 0x3F));
+        return 3;
+    }
+    else
+    {
+        outSeq[0] = (char)(0xF0 | (codePoint >> 18));
+        outSeq[1] = (char)(0x80 | ((codePoint >> 12) & 0x3F));
+        outSeq[2] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        outSeq[3] = (char)(0x80 | (codePoint & 0x3F));
+        return 4;
+    }
+}
+
+/**
+ * @brief   Converts a hex digit to its value, returns -1 if c is not a hex digit.
+ *
+ */
+static int cJSON_Parser_HexValue(char c)
+{
+    if ((c >= '0') && (c <= '9')) return c - '0';
+
+    c = LOWER_CASE_CHAR(c);
+    if ((c >= 'a') && (c <= 'f')) return 10 + (c - 'a');
+
+    return -1;
+}
+/**
+ * @brief   Parses the 4 hex digits following ptr, returns false on malformed digits.
+ *
+ */
+static bool cJSON_Parser_HexQuad(const char *ptr, const char *endPtr, uint32_t *value)
+{
+    if ((endPtr - ptr) < 4) return false;
+
+    *value = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        int digit = cJSON_Parser_HexValue(ptr[i]);
+        if (digit < 0) return false;
+        *value = (*value << 4) | (uint32_t)digit;
+    }
+
+    return true;
+}
+
+cJSON_Result_t cJSON_Parser_ParseUnicodeEscape(const char **refStrPtr, const char *endPtr, uint32_t *codePoint)
+{
+    uint32_t highUnit;
+
+    if (!cJSON_Parser_HexQuad(*refStrPtr + 1, endPtr, &highUnit)) return cJSON_InvalidCharacterSequence_Error;
+
+    // Lone low surrogate
+    if ((highUnit >= 0xDC00) && (highUnit <= 0xDFFF)) return cJSON_InvalidCharacterSequence_Error;
+
+    if ((highUnit >= 0xD800) && (highUnit <= 0xDBFF))
+    {
+        // High surrogate, must be followed by an escaped low surrogate
+        const char *lowPtr = *refStrPtr + 5;
+        uint32_t lowUnit;
+
+        if (((endPtr - lowPtr) < 6) || (lowPtr[0] != '\\') || (lowPtr[1] != 'u')) return cJSON_InvalidCharacterSequence_Error;
+        if (!cJSON_Parser_HexQuad(lowPtr + 2, endPtr, &lowUnit)) return cJSON_InvalidCharacterSequence_Error;
+        if ((lowUnit < 0xDC00) || (lowUnit > 0xDFFF)) return cJSON_InvalidCharacterSequence_Error;
+
+        *codePoint = 0x10000 + (((highUnit - 0xD800) << 10) | (lowUnit - 0xDC00));
+        *refStrPtr += 10;
+    }
+    else
+    {
+        *codePoint = highUnit;
+        *refStrPtr += 4;
+    }
+
+    return cJSON_Ok;
+}
+
+cJSON_Result_t cJSON_Parser_SkipString(const char **refStrPtr, const char *endPtr)
+{
+    const char *str = *refStrPtr + 1;
+
+    while (str < endPtr)
+    {
+        // Skip plain characters, validate their encoding as a whole run
+        const char *runEnd = SCAN_StringRun(str, endPtr);
+        size_t utf8ErrOffset;
 
-            // Write buffer pointer containing formatted extracted string to output string pointer
-            *outputStrPtr = SDB_BuildString(outBuf);
+        if (!SCAN_ValidateUTF8(str, (size_t)(runEnd - str), &utf8ErrOffset))
+        {
+            *refStrPtr = str + utf8ErrOffset;
+            return cJSON_InvalidCharacterSequence_Error;
+        }
 
-            // Free StringDoubleBuffer
-            SDB_Free(&outBuf);
+        str = runEnd;
+        if (str >= endPtr) break;
 
+        if (*str == '"')
+        {
+            *refStrPtr = str;
             return cJSON_Ok;
         }
-        else if (**refStrPtr == '\\')
+        else if (*str == '\\')
         {
-            // Start escape sequence
-            inEscapeSequence = true;
+            str++;
+            if (str >= endPtr) break;
+
+            switch (*str)
+            {
+            case '"':
+            case '\\':
+            case '/':
+            case 'b':
+            case 'f':
+            case 'n':
+            case 'r':
+            case 't':
+                break;
+            case 'u':;
+                uint32_t codePoint;
+                if (cJSON_Parser_ParseUnicodeEscape(&str, endPtr, &codePoint) != cJSON_Ok)
+                {
+                    *refStrPtr = str;
+                    return cJSON_InvalidCharacterSequence_Error;
+                }
+                break;
+            default:
+                // Unknown escape sequence
+                *refStrPtr = str;
+                return cJSON_InvalidCharacterSequence_Error;
+            }
+
+            str++;
         }
         else
         {
-            // Add normal character to buffer
-            SDB_AddChar(&outBuf, **refStrPtr);
+            // Unescaped control character
+            *refStrPtr = str;
+            return cJSON_InvalidCharacterSequence_Error;
         }
     }
 
-    // Free StringDoubleBuffer
-    SDB_Free(&outBuf);
-
-    // String terminator reached before string finished
+    // End of data reached before string finished
+    *refStrPtr = endPtr;
     return cJSON_Structure_Error;
 }
+bool cJSON_Parser_MatchLiteral(const char *str, const char *endPtr, const char *literal, size_t literalLen)
+{
+    if ((size_t)(endPtr - str) < literalLen) return false;
+
+    for (size_t i = 0; i < literalLen; i++)
+    {
+        if (LOWER_CASE_CHAR(str[i]) != literal[i]) return false;
+    }
+
+    return true;
+}
 
 #pragma endregion
 
 // - Number Parser Function Implementation -
 #pragma region Number Parser Function Implementation
 
-cJSON_Generic_t cJSON_Parser_NumParser(char **refStrPtr)
+cJSON_Result_t cJSON_Parser_NumParser(const char **refStrPtr, const char *endPtr, char *numBuffer, cJSON_Arena_t *arena, cJSON_Generic_t *numObj)
 {
-    cJSON_Generic_t returnObj;
+    bool numIsFloat;
+    cJSON_Int_t intVal;
+    cJSON_Float_t floatVal;
+
+    cJSON_Result_t result = cJSON_Parser_NumValue(refStrPtr, endPtr, numBuffer, &numIsFloat, &intVal, &floatVal);
+    if (result != cJSON_Ok) return result;
 
-    uint8_t numStrLen = 0;
+    if (numIsFloat)
+    {
+        // Build generic float object
+        *numObj = allocGenObj(arena, Float);
+        AS_FLOAT(*numObj) = floatVal;
+    }
+    else
+    {
+        // Build generic integer object
+        *numObj = allocGenObj(arena, Integer);
+        AS_INT(*numObj) = intVal;
+    }
+
+    return cJSON_Ok;
+}
+cJSON_Result_t cJSON_Parser_NumValue(const char **refStrPtr, const char *endPtr, char *numBuffer, bool *isFloat, cJSON_Int_t *intVal, cJSON_Float_t *floatVal)
+{
+    CJSON_STATS_BEGIN(cJSON_NumberPhase, startTime);
     bool numIsFloat = false;
-    bool numIncomplete = true;
+    size_t numStrLen = cJSON_Parser_ScanNumber(*refStrPtr, endPtr, &numIsFloat);
 
-    while (numIncomplete)
+    // Malformed number or number does not fit into the scratch buffer
+    if ((numStrLen == 0) || (numStrLen > CJSON_MAX_NUM_LEN))
     {
-        switch (LOWER_CASE_CHAR(*(*refStrPtr + numStrLen)))
-        {
-        case '.':
-        case 'e':
-            numIsFloat = true;
-        case '-':
-        case '0':
-        case '1':
-        case '2':
-        case '3':
-        case '4':
-        case '5':
-        case '6':
-        case '7':
-        case '8':
-        case '9':
-            numStrLen++;
-            break;
-        default:
-            numIncomplete = false;
-        }
+        CJSON_STATS_END(cJSON_NumberPhase, startTime);
+        return cJSON_InvalidCharacterSequence_Error;
     }
 
-    // Copy string of number to separate memory location
-    char *numStrBuffer = (char*)malloc(1 + numStrLen);
-    memcpy(numStrBuffer, *refStrPtr, numStrLen);
-    numStrBuffer[numStrLen - 1] = '\0';
+    // Copy string of number to scratch buffer, so it can be null terminated
+    memcpy(numBuffer, *refStrPtr, numStrLen);
+    numBuffer[numStrLen] = '\0';
 
-    if (numIsFloat)
+    *isFloat = numIsFloat;
+    if (numIsFloat) *floatVal = (cJSON_Float_t)strtod(numBuffer, NULL);
+    else            *intVal = (cJSON_Int_t)strtol(numBuffer, NULL, 10);
+
+    // Skip number in reference string pointer's pointer
+    *refStrPtr += numStrLen - 1;
+
+    CJSON_STATS_END(cJSON_NumberPhase, startTime);
+
+    return cJSON_Ok;
+}
+size_t cJSON_Parser_ScanNumber(const char *ptr, const char *endPtr, bool *isFloat)
+{
+    const char *startPtr = ptr;
+    bool numIsFloat = false;
+
+    // Optional sign
+    if ((ptr < endPtr) && (*ptr == '-')) ptr++;
+
+    // Integer part, leading zeros are not allowed
+    if (ptr >= endPtr) return 0;
+    if (*ptr == '0')
     {
-        // Build generic integer object
-        returnObj = mallocGenObj(Float);
-        AS_INT(returnObj) = (cJSON_Int_t)atoi(numStrBuffer);
+        ptr++;
+    }
+    else if ((*ptr >= '1') && (*ptr <= '9'))
+    {
+        while ((ptr < endPtr) && (*ptr >= '0') && (*ptr <= '9')) ptr++;
     }
     else
     {
-        // Build generic float object
-        returnObj = mallocGenObj(Integer);
-        AS_FLOAT(returnObj) = (cJSON_Float_t)atof(numStrBuffer);
+        return 0;
     }
 
-    // Skip number in reference string pointer's pointer
-    *refStrPtr += numStrLen - 1;
+    // Optional fraction
+    if ((ptr < endPtr) && (*ptr == '.'))
+    {
+        ptr++;
+        numIsFloat = true;
+
+        if ((ptr >= endPtr) || (*ptr < '0') || (*ptr > '9')) return 0;
+        while ((ptr < endPtr) && (*ptr >= '0') && (*ptr <= '9')) ptr++;
+    }
+
+    // Optional exponent
+    if ((ptr < endPtr) && (LOWER_CASE_CHAR(*ptr) == 'e'))
+    {
+        ptr++;
+        numIsFloat = true;
+
+        if ((ptr < endPtr) && ((*ptr == '+') || (*ptr == '-'))) ptr++;
+
+        if ((ptr >= endPtr) || (*ptr < '0') || (*ptr > '9')) return 0;
+        while ((ptr < endPtr) && (*ptr >= '0') && (*ptr <= '9')) ptr++;
+    }
+
+    if (isFloat != NULL) *isFloat = numIsFloat;
+
+    return (size_t)(ptr - startPtr);
+}
+
+#pragma endregion
+
+// - Value Skipper Function Implementations -
+#pragma region Value Skipper Function Implementations
+
+cJSON_Result_t cJSON_Parser_SkipValue(const char **refStrPtr, const char *endPtr, size_t depth)
+{
+    const char *str = *refStrPtr;
+    cJSON_Result_t result = cJSON_Ok;
+
+    if (str >= endPtr) return cJSON_Structure_Error;
+
+    if (*str == '"')
+    {
+        return cJSON_Parser_SkipString(refStrPtr, endPtr);
+    }
+    else if ((*str == '{') || (*str == '['))
+    {
+        char closeChar = (*str == '{') ? '}' : ']';
+
+        if (depth >= CJSON_MAX_DEPTH) return cJSON_DepthOutOfRange_Error;
+
+        str = SCAN_SkipWhitespace(str + 1, endPtr);
+
+        if ((str >= endPtr) || (*str != closeChar))
+        {
+            while (true)
+            {
+                if (closeChar == '}')
+                {
+                    // Key and key-value separator
+                    if ((str >= endPtr) || (*str != '"'))   { result = cJSON_Structure_Error; break; }
+
+                    result = cJSON_Parser_SkipString(&str, endPtr);
+                    if (result != cJSON_Ok) break;
+
+                    str = SCAN_SkipWhitespace(str + 1, endPtr);
+                    if ((str >= endPtr) || (*str != ':'))   { result = cJSON_Structure_Error; break; }
+                    str = SCAN_SkipWhitespace(str + 1, endPtr);
+                }
+
+                result = cJSON_Parser_SkipValue(&str, endPtr, depth + 1);
+                if (result != cJSON_Ok) break;
+
+                // Item separator or end of container
+                str = SCAN_SkipWhitespace(str + 1, endPtr);
+                if ((str >= endPtr) || ((*str != ',') && (*str != closeChar)))  { result = cJSON_Structure_Error; break; }
+                if (*str == closeChar) break;
+
+                str = SCAN_SkipWhitespace(str + 1, endPtr);
+            }
+        }
+    }
+    else
+    {
+        size_t tokenLen = 0;
+
+        if ((*str == '-') || ((*str >= '0') && (*str <= '9')))
+        {
+            tokenLen = cJSON_Parser_ScanNumber(str, endPtr, NULL);
+            if (tokenLen > CJSON_MAX_NUM_LEN) tokenLen = 0;
+            if (tokenLen == 0) result = cJSON_InvalidCharacterSequence_Error;
+        }
+        else if (cJSON_Parser_MatchLiteral(str, endPtr, "true", 4))     tokenLen = 4;
+        else if (cJSON_Parser_MatchLiteral(str, endPtr, "false", 5))    tokenLen = 5;
+        else if (cJSON_Parser_MatchLiteral(str, endPtr, "null", 4))     tokenLen = 4;
+        else result = cJSON_Structure_Error;
+
+        // Point to the last character of the token
+        if (result == cJSON_Ok) str += tokenLen - 1;
+    }
 
-    return returnObj;
+    *refStrPtr = (str < endPtr) ? str : endPtr;
+    return result;
 }
 
 #pragma endregion
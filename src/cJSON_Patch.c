@@ -0,0 +1,707 @@
+/**
+ * @file cJSON_Patch.c
+ * @author HeCoding180
+ * @brief cJSON library patch source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include <stdio.h>
+
+#include "../inc/cJSON.h"
+#include "../inc/cJSON_Patch.h"
+#include "../inc/cJSON_StringDoubleBuffer.h"
+#include "../inc/cJSON_Util.h"
+
+//   ---   Defines   ---
+
+/**
+ * @brief   Minimum dictionary length for which cJSON_diff builds a temporary key hash index instead of scanning.
+ *
+ */
+#define CJSON_PATCH_INDEX_MIN_LENGTH    8U
+
+//   ---   Typedefs   ---
+
+/**
+ * @brief   Temporary open addressing hash index over the keys of a dictionary.
+ *
+ */
+typedef struct cJSON_PatchKeyIndex
+{
+    uint32_t *slots;
+    uint32_t slotMask;
+} cJSON_PatchKeyIndex_t;
+
+//   ---   Static Function Implementations   ---
+
+// - Patch Helper Functions -
+#pragma region Patch Helper Functions
+
+/**
+ * @brief   Builds a hash index over the keys of dictPtr. Slots store index + 1, zero marks an empty slot. Returns false if the slots could not be allocated.
+ *
+ */
+static bool cJSON_Patch_BuildIndex(const cJSON_Dict_t *dictPtr, cJSON_PatchKeyIndex_t *keyIndex)
+{
+    uint32_t slotCount = 16;
+
+    while (slotCount < 2 * dictPtr->length) slotCount *= 2;
+
+    keyIndex->slots = (uint32_t*)calloc(slotCount, sizeof(uint32_t));
+    if (keyIndex->slots == NULL) return false;
+
+    keyIndex->slotMask = slotCount - 1;
+
+    for (cJSON_object_size_size_t i = 0; i < dictPtr->length; i++)
+    {
+        uint32_t slot = (uint32_t)HASH_Bytes(dictPtr->keyData[i], cJSON_getDictKeyLength(dictPtr, i), 0) & keyIndex->slotMask;
+
+        while (keyIndex->slots[slot] != 0) slot = (slot + 1) & keyIndex->slotMask;
+        keyIndex->slots[slot] = i + 1;
+    }
+
+    return true;
+}
+/**
+ * @brief   Looks up key of keyLength bytes (may contain null characters) using a hash index built by cJSON_Patch_BuildIndex.
+ *
+ */
+static bool cJSON_Patch_IndexLookup(const cJSON_PatchKeyIndex_t *keyIndex, const cJSON_Dict_t *dictPtr, const char *key, size_t keyLength, cJSON_object_size_size_t *index)
+{
+    uint32_t slot = (uint32_t)HASH_Bytes(key, keyLength, 0) & keyIndex->slotMask;
+
+    while (keyIndex->slots[slot] != 0)
+    {
+        cJSON_object_size_size_t candidate = keyIndex->slots[slot] - 1;
+
+        if ((cJSON_getDictKeyLength(dictPtr, candidate) == keyLength) && !memcmp(dictPtr->keyData[candidate], key, keyLength))
+        {
+            *index = candidate;
+            return true;
+        }
+
+        slot = (slot + 1) & keyIndex->slotMask;
+    }
+
+    return false;
+}
+
+/**
+ * @brief   Creates a heap allocated generic string object holding a copy of the length bytes of str (may contain null characters). The data container is NULL if it could not be allocated.
+ *
+ */
+static cJSON_Generic_t cJSON_Patch_NewString(const char *str, size_t length)
+{
+    cJSON_Generic_t strObj = mallocGenObj(String);
+    size_t strSize = 1 + length;
+
+    strObj.strSize = (uint32_t)strSize;
+    strObj.dataContainer = malloc(strSize);
+    if (strObj.dataContainer != NULL)
+    {
+        memcpy(strObj.dataContainer, str, length);
+        ((char*)strObj.dataContainer)[length] = '\0';
+    }
+
+    return strObj;
+}
+
+/**
+ * @brief   Appends an escaped JSON pointer reference token ("/" + token, "~" -> "~0", "/" -> "~1") of tokenLength bytes to path. Null characters are copied as they are.
+ *
+ */
+static void cJSON_Patch_PushToken(cJSON_SDB_t *path, const char *token, size_t tokenLength)
+{
+    const char *tokenEnd = token + tokenLength;
+
+    SDB_AddChar(path, '/');
+
+    for (; token < tokenEnd; token++)
+    {
+        if (*token == '~')          SDB_AddChars(path, "~0", 2);
+        else if (*token == '/')     SDB_AddChars(path, "~1", 2);
+        else                        SDB_AddChar(path, *token);
+    }
+}
+/**
+ * @brief   Appends a list index reference token to path.
+ *
+ */
+static void cJSON_Patch_PushIndex(cJSON_SDB_t *path, cJSON_object_size_size_t index)
+{
+    char indexStr[16];
+    int indexLength = snprintf(indexStr, sizeof(indexStr), "%" PRIu32, (uint32_t)index);
+    cJSON_Patch_PushToken(path, indexStr, (size_t)indexLength);
+}
+
+/**
+ * @brief   Appends an operation dictionary to the patch list. The value (if any) is cloned into the patch. Returns cJSON_NotAllocated_Error if the operation could not be allocated, the patch is left unchanged then.
+ *
+ */
+static cJSON_Result_t cJSON_Patch_AddOp(cJSON_Generic_t patch, const char *op, cJSON_SDB_t *path, const cJSON_Generic_t *value)
+{
+    cJSON_Generic_t opObj = mallocGenObj(Dictionary);
+    cJSON_Generic_t opStr, pathStr;
+
+    if (opObj.dataContainer == NULL) return cJSON_NotAllocated_Error;
+
+    opStr = cJSON_Patch_NewString(op, strlen(op));
+    pathStr = cJSON_Patch_NewString(SDB_GetStr(path), path->bufferSize);
+
+    if ((opStr.dataContainer == NULL) || (pathStr.dataContainer == NULL))
+    {
+        cJSON_delGenObj(opStr);
+        cJSON_delGenObj(pathStr);
+        cJSON_delGenObj(opObj);
+        return cJSON_NotAllocated_Error;
+    }
+
+    cJSON_appendToDict(NULL, AS_DICT_PTR(opObj), "op", 2, opStr);
+    cJSON_appendToDict(NULL, AS_DICT_PTR(opObj), "path", 4, pathStr);
+
+    if (value != NULL)
+    {
+        cJSON_Generic_t valueCopy;
+
+        if (cJSON_clone(*value, &valueCopy, NULL) != cJSON_Ok)
+        {
+            cJSON_delGenObj(opObj);
+            return cJSON_NotAllocated_Error;
+        }
+
+        cJSON_appendToDict(NULL, AS_DICT_PTR(opObj), "value", 5, valueCopy);
+    }
+
+    cJSON_appendToList(NULL, AS_LIST_PTR(patch), opObj);
+
+    return cJSON_Ok;
+}
+
+static cJSON_Result_t cJSON_Patch_DiffValue(cJSON_Generic_t oldObj, cJSON_Generic_t newObj, cJSON_SDB_t *path, cJSON_Generic_t patch);
+
+/**
+ * @brief   Emits remove operations for keys only present in oldDict, add operations for keys only present in newDict and recurses into shared keys.
+ *
+ */
+static cJSON_Result_t cJSON_Patch_DiffDict(cJSON_Dict_t *oldDict, cJSON_Dict_t *newDict, cJSON_SDB_t *path, cJSON_Generic_t patch)
+{
+    size_t pathLen = path->bufferSize;
+    bool useIndex = newDict->length >= CJSON_PATCH_INDEX_MIN_LENGTH;
+    cJSON_PatchKeyIndex_t keyIndex = {0};
+    bool *newKeyMatched = (bool*)calloc(newDict->length + 1, sizeof(bool));
+    cJSON_Result_t result = cJSON_Ok;
+
+    if ((newKeyMatched == NULL) || (useIndex && !cJSON_Patch_BuildIndex(newDict, &keyIndex)))
+    {
+        free(newKeyMatched);
+        return cJSON_NotAllocated_Error;
+    }
+
+    for (cJSON_object_size_size_t i = 0; (i < oldDict->length) && (result == cJSON_Ok); i++)
+    {
+        cJSON_object_size_size_t newIndex;
+        size_t keyLength = cJSON_getDictKeyLength(oldDict, i);
+        bool found = useIndex ? cJSON_Patch_IndexLookup(&keyIndex, newDict, oldDict->keyData[i], keyLength, &newIndex)
+                              : cJSON_findDictKeyView(newDict, oldDict->keyData[i], keyLength, i, &newIndex);
+
+        cJSON_Patch_PushToken(path, oldDict->keyData[i], keyLength);
+
+        if (found)
+        {
+            newKeyMatched[newIndex] = true;
+            result = cJSON_Patch_DiffValue(oldDict->valueData[i], newDict->valueData[newIndex], path, patch);
+        }
+        else
+        {
+            result = cJSON_Patch_AddOp(patch, "remove", path, NULL);
+        }
+
+        path->bufferSize = pathLen;
+    }
+
+    for (cJSON_object_size_size_t i = 0; (i < newDict->length) && (result == cJSON_Ok); i++)
+    {
+        if (newKeyMatched[i]) continue;
+
+        cJSON_Patch_PushToken(path, newDict->keyData[i], cJSON_getDictKeyLength(newDict, i));
+        result = cJSON_Patch_AddOp(patch, "add", path, &newDict->valueData[i]);
+        path->bufferSize = pathLen;
+    }
+
+    free(newKeyMatched);
+    if (useIndex) free(keyIndex.slots);
+
+    return result;
+}
+
+/**
+ * @brief   Skips the identical prefix and suffix of both lists (compared by item hash first), diffs the remaining items pairwise and emits remove/add operations for the length difference.
+ *
+ */
+static cJSON_Result_t cJSON_Patch_DiffList(cJSON_List_t *oldList, cJSON_List_t *newList, cJSON_SDB_t *path, cJSON_Generic_t patch)
+{
+    size_t pathLen = path->bufferSize;
+    cJSON_object_size_size_t minLength = MIN(oldList->length, newList->length);
+    cJSON_object_size_size_t prefixLen = 0, suffixLen = 0;
+    cJSON_Result_t result = cJSON_Ok;
+
+    uint64_t *oldHashes = (uint64_t*)malloc((oldList->length + 1) * sizeof(uint64_t));
+    uint64_t *newHashes = (uint64_t*)malloc((newList->length + 1) * sizeof(uint64_t));
+
+    if ((oldHashes == NULL) || (newHashes == NULL))
+    {
+        free(oldHashes);
+        free(newHashes);
+        return cJSON_NotAllocated_Error;
+    }
+
+    for (cJSON_object_size_size_t i = 0; i < oldList->length; i++) oldHashes[i] = cJSON_hash(oldList->data[i]);
+    for (cJSON_object_size_size_t i = 0; i < newList->length; i++) newHashes[i] = cJSON_hash(newList->data[i]);
+
+    // Identical prefix and suffix
+    while ((prefixLen < minLength)
+        && (oldHashes[prefixLen] == newHashes[prefixLen])
+        && cJSON_equals(oldList->data[prefixLen], newList->data[prefixLen])) prefixLen++;
+
+    while ((suffixLen < minLength - prefixLen)
+        && (oldHashes[oldList->length - 1 - suffixLen] == newHashes[newList->length - 1 - suffixLen])
+        && cJSON_equals(oldList->data[oldList->length - 1 - suffixLen], newList->data[newList->length - 1 - suffixLen])) suffixLen++;
+
+    cJSON_object_size_size_t oldMiddle = oldList->length - prefixLen - suffixLen;
+    cJSON_object_size_size_t newMiddle = newList->length - prefixLen - suffixLen;
+
+    // Pairwise diff of the changed middle section
+    for (cJSON_object_size_size_t i = 0; (i < MIN(oldMiddle, newMiddle)) && (result == cJSON_Ok); i++)
+    {
+        cJSON_object_size_size_t index = prefixLen + i;
+
+        if (oldHashes[index] == newHashes[index] && cJSON_equals(oldList->data[index], newList->data[index])) continue;
+
+        cJSON_Patch_PushIndex(path, index);
+        result = cJSON_Patch_DiffValue(oldList->data[index], newList->data[index], path, patch);
+        path->bufferSize = pathLen;
+    }
+
+    if (oldMiddle > newMiddle)
+    {
+        // Remove surplus items, every removal shifts the following items to the same index
+        cJSON_Patch_PushIndex(path, prefixLen + newMiddle);
+        for (cJSON_object_size_size_t i = newMiddle; (i < oldMiddle) && (result == cJSON_Ok); i++) result = cJSON_Patch_AddOp(patch, "remove", path, NULL);
+        path->bufferSize = pathLen;
+    }
+    else
+    {
+        // Insert missing items in order
+        for (cJSON_object_size_size_t i = oldMiddle; (i < newMiddle) && (result == cJSON_Ok); i++)
+        {
+            cJSON_Patch_PushIndex(path, prefixLen + i);
+            result = cJSON_Patch_AddOp(patch, "add", path, &newList->data[prefixLen + i]);
+            path->bufferSize = pathLen;
+        }
+    }
+
+    free(oldHashes);
+    free(newHashes);
+
+    return result;
+}
+
+/**
+ * @brief   Emits the operations transforming oldObj into newObj at path.
+ *
+ */
+static cJSON_Result_t cJSON_Patch_DiffValue(cJSON_Generic_t oldObj, cJSON_Generic_t newObj, cJSON_SDB_t *path, cJSON_Generic_t patch)
+{
+    if (IS_LIST_TYPE(oldObj.type) && IS_LIST_TYPE(newObj.type) && ((oldObj.type != List) || (newObj.type != List)))
+    {
+        // Packed numeric arrays are replaced as a whole
+        if (!cJSON_equals(oldObj, newObj)) return cJSON_Patch_AddOp(patch, "replace", path, &newObj);
+    }
+    else if (oldObj.type != newObj.type)
+    {
+        return cJSON_Patch_AddOp(patch, "replace", path, &newObj);
+    }
+    else if (oldObj.type == Dictionary)
+    {
+        return cJSON_Patch_DiffDict(AS_DICT_PTR(oldObj), AS_DICT_PTR(newObj), path, patch);
+    }
+    else if (oldObj.type == List)
+    {
+        return cJSON_Patch_DiffList(AS_LIST_PTR(oldObj), AS_LIST_PTR(newObj), path, patch);
+    }
+    else if (!cJSON_equals(oldObj, newObj))
+    {
+        return cJSON_Patch_AddOp(patch, "replace", path, &newObj);
+    }
+
+    return cJSON_Ok;
+}
+
+/**
+ * @brief   Reads the next reference token of a JSON pointer ending at endPtr into token (unescaped, may contain null characters). Returns false if path does not start with '/'.
+ *
+ */
+static bool cJSON_Patch_NextToken(const char **pathPtr, const char *endPtr, cJSON_SDB_t *token)
+{
+    const char *path = *pathPtr;
+
+    if ((path >= endPtr) || (*path != '/')) return false;
+    path++;
+
+    SDB_Reset(token);
+
+    for (; (path < endPtr) && (*path != '/'); path++)
+    {
+        bool isEscape = (path[0] == '~') && (path + 1 < endPtr);
+
+        if (isEscape && (path[1] == '0'))           { SDB_AddChar(token, '~'); path++; }
+        else if (isEscape && (path[1] == '1'))      { SDB_AddChar(token, '/'); path++; }
+        else                                        SDB_AddChar(token, *path);
+    }
+
+    *pathPtr = path;
+    return true;
+}
+/**
+ * @brief   Parses a list index reference token of tokenLength bytes. Returns false on malformed tokens (leading zeros, non-digits) and on "-".
+ *
+ */
+static bool cJSON_Patch_ParseIndex(const char *token, size_t tokenLength, cJSON_object_size_size_t *index)
+{
+    const char *tokenEnd = token + tokenLength;
+
+    if ((tokenLength == 0) || ((token[0] == '0') && (tokenLength > 1))) return false;
+
+    uint64_t value = 0;
+    for (; token < tokenEnd; token++)
+    {
+        if ((*token < '0') || (*token > '9')) return false;
+        value = 10 * value + (uint64_t)(*token - '0');
+        if (value > UINT32_MAX) return false;
+    }
+
+    *index = (cJSON_object_size_size_t)value;
+    return true;
+}
+/**
+ * @brief   Returns the slot of the child of parent referenced by token (tokenLength bytes, may contain null characters), NULL if it does not exist.
+ *
+ */
+static cJSON_Generic_t* cJSON_Patch_Child(cJSON_Generic_t *parent, const char *token, size_t tokenLength)
+{
+    cJSON_object_size_size_t index;
+
+    // Items of packed numeric arrays have no slots of their own
+    cJSON_tryUnpackList(parent);
+
+    if (parent->type == Dictionary)
+    {
+        if (cJSON_findDictKeyView(AS_DICT_PTR(*parent), token, tokenLength, 0, &index)) return &AS_DICT_PTR(*parent)->valueData[index];
+    }
+    else if (parent->type == List)
+    {
+        if (cJSON_Patch_ParseIndex(token, tokenLength, &index) && (index < AS_LIST_PTR(*parent)->length)) return &AS_LIST_PTR(*parent)->data[index];
+    }
+
+    return NULL;
+}
+/**
+ * @brief   Resolves all but the last reference token of path (pathLength bytes). parentPtr is set to the slot of the parent (NULL for the root path ""), token holds the last reference token.
+ *
+ */
+static cJSON_Result_t cJSON_Patch_Resolve(cJSON_Generic_t *GObjPtr, const char *path, size_t pathLength, cJSON_Generic_t **parentPtr, cJSON_SDB_t *token)
+{
+    cJSON_Generic_t *current = GObjPtr;
+    const char *endPtr = path + pathLength;
+
+    if (path == endPtr)
+    {
+        *parentPtr = NULL;
+        return cJSON_Ok;
+    }
+
+    while (true)
+    {
+        if (!cJSON_Patch_NextToken(&path, endPtr, token)) return cJSON_Structure_Error;
+
+        if (path == endPtr)
+        {
+            // Packed numeric arrays are modified as generic lists
+            cJSON_tryUnpackList(current);
+
+            *parentPtr = current;
+            return cJSON_Ok;
+        }
+
+        current = cJSON_Patch_Child(current, SDB_GetStr(token), token->bufferSize);
+        if (current == NULL) return cJSON_NotFound_Error;
+    }
+}
+/**
+ * @brief   Returns the slot of the value referenced by path, NULL if it does not exist.
+ *
+ */
+static cJSON_Generic_t* cJSON_Patch_Get(cJSON_Generic_t *GObjPtr, const char *path, size_t pathLength, cJSON_SDB_t *token)
+{
+    cJSON_Generic_t *parent;
+
+    if (cJSON_Patch_Resolve(GObjPtr, path, pathLength, &parent, token) != cJSON_Ok) return NULL;
+    if (parent == NULL) return GObjPtr;
+
+    return cJSON_Patch_Child(parent, SDB_GetStr(token), token->bufferSize);
+}
+
+/**
+ * @brief   Adds value at path (RFC 6902 "add"). Takes ownership of value on success.
+ *
+ */
+static cJSON_Result_t cJSON_Patch_Add(cJSON_Generic_t *GObjPtr, const char *path, size_t pathLength, cJSON_Generic_t value, cJSON_SDB_t *token)
+{
+    cJSON_Generic_t *parent;
+    cJSON_Result_t result = cJSON_Patch_Resolve(GObjPtr, path, pathLength, &parent, token);
+    cJSON_object_size_size_t index;
+
+    if (result != cJSON_Ok) return result;
+
+    if (parent == NULL)
+    {
+        // Replace whole document
+        cJSON_delGenObj(*GObjPtr);
+        *GObjPtr = value;
+    }
+    else if (parent->type == Dictionary)
+    {
+        if (cJSON_findDictKeyView(AS_DICT_PTR(*parent), SDB_GetStr(token), token->bufferSize, 0, &index))
+        {
+            // Existing member is replaced
+            cJSON_delGenObj(AS_DICT_PTR(*parent)->valueData[index]);
+            AS_DICT_PTR(*parent)->valueData[index] = value;
+        }
+        else
+        {
+            cJSON_appendToDict(NULL, AS_DICT_PTR(*parent), SDB_GetStr(token), token->bufferSize, value);
+        }
+    }
+    else if (parent->type == List)
+    {
+        if ((token->bufferSize == 1) && (SDB_GetStr(token)[0] == '-'))
+        {
+            cJSON_appendToList(NULL, AS_LIST_PTR(*parent), value);
+        }
+        else if (cJSON_Patch_ParseIndex(SDB_GetStr(token), token->bufferSize, &index) && (index <= AS_LIST_PTR(*parent)->length))
+        {
+            cJSON_insertIntoList(NULL, AS_LIST_PTR(*parent), index, value);
+        }
+        else
+        {
+            return cJSON_NotFound_Error;
+        }
+    }
+    else
+    {
+        return cJSON_NotFound_Error;
+    }
+
+    return cJSON_Ok;
+}
+/**
+ * @brief   Detaches the value at path (RFC 6902 "remove"). The detached value is stored in removed and owned by the caller.
+ *
+ */
+static cJSON_Result_t cJSON_Patch_Remove(cJSON_Generic_t *GObjPtr, const char *path, size_t pathLength, cJSON_Generic_t *removed, cJSON_SDB_t *token)
+{
+    cJSON_Generic_t *parent;
+    cJSON_Result_t result = cJSON_Patch_Resolve(GObjPtr, path, pathLength, &parent, token);
+    cJSON_object_size_size_t index;
+
+    if (result != cJSON_Ok) return result;
+
+    if (parent == NULL)
+    {
+        // Removing the root leaves a null document
+        *removed = *GObjPtr;
+        GObjPtr->type = NullType;
+        GObjPtr->dataContainer = NULL;
+    }
+    else if ((parent->type == Dictionary) && cJSON_findDictKeyView(AS_DICT_PTR(*parent), SDB_GetStr(token), token->bufferSize, 0, &index))
+    {
+        *removed = cJSON_detachFromDict(AS_DICT_PTR(*parent), index);
+    }
+    else if ((parent->type == List) && cJSON_Patch_ParseIndex(SDB_GetStr(token), token->bufferSize, &index) && (index < AS_LIST_PTR(*parent)->length))
+    {
+        *removed = cJSON_detachFromList(AS_LIST_PTR(*parent), index);
+    }
+    else
+    {
+        return cJSON_NotFound_Error;
+    }
+
+    return cJSON_Ok;
+}
+
+/**
+ * @brief   Returns the string member key of the operation dictionary opDict, NULL if missing or not a string. The string's length is stored in length if it isn't NULL (paths may contain null characters).
+ *
+ */
+static const char* cJSON_Patch_OpString(cJSON_Dict_t *opDict, const char *key, size_t *length)
+{
+    cJSON_object_size_size_t index;
+
+    if (!cJSON_findDictKey(opDict, key, 0, &index) || (opDict->valueData[index].type != String)) return NULL;
+
+    if (length != NULL) *length = AS_STRING_LENGTH(opDict->valueData[index]);
+    return AS_STRING(opDict->valueData[index]);
+}
+
+/**
+ * @brief   Applies a single operation dictionary.
+ *
+ */
+static cJSON_Result_t cJSON_Patch_ApplyOp(cJSON_Generic_t *GObjPtr, cJSON_Dict_t *opDict, cJSON_SDB_t *token)
+{
+    size_t pathLen = 0, fromLen = 0;
+    const char *op = cJSON_Patch_OpString(opDict, "op", NULL);
+    const char *path = cJSON_Patch_OpString(opDict, "path", &pathLen);
+    const char *from = cJSON_Patch_OpString(opDict, "from", &fromLen);
+    cJSON_Generic_t *value = NULL;
+    cJSON_Generic_t *fromValue;
+    cJSON_Generic_t valueCopy;
+    cJSON_Result_t result;
+    cJSON_object_size_size_t index;
+
+    if ((op == NULL) || (path == NULL)) return cJSON_Datatype_Error;
+    if (cJSON_findDictKey(opDict, "value", 0, &index)) value = &opDict->valueData[index];
+
+    if (!strcmp(op, "add") || !strcmp(op, "replace"))
+    {
+        if (value == NULL) return cJSON_Datatype_Error;
+
+        // Replace requires an existing target
+        if (!strcmp(op, "replace"))
+        {
+            cJSON_Generic_t *target = cJSON_Patch_Get(GObjPtr, path, pathLen, token);
+            if (target == NULL) return cJSON_NotFound_Error;
+
+            if (cJSON_clone(*value, &valueCopy, NULL) != cJSON_Ok) return cJSON_NotAllocated_Error;
+
+            cJSON_delGenObj(*target);
+            *target = valueCopy;
+            return cJSON_Ok;
+        }
+
+        if (cJSON_clone(*value, &valueCopy, NULL) != cJSON_Ok) return cJSON_NotAllocated_Error;
+
+        result = cJSON_Patch_Add(GObjPtr, path, pathLen, valueCopy, token);
+        if (result != cJSON_Ok) cJSON_delGenObj(valueCopy);
+        return result;
+    }
+    else if (!strcmp(op, "remove"))
+    {
+        cJSON_Generic_t removed;
+
+        result = cJSON_Patch_Remove(GObjPtr, path, pathLen, &removed, token);
+        if (result == cJSON_Ok) cJSON_delGenObj(removed);
+        return result;
+    }
+    else if (!strcmp(op, "move"))
+    {
+        cJSON_Generic_t moved;
+
+        if (from == NULL) return cJSON_Datatype_Error;
+
+        // A value can't be moved into one of its own children
+        if ((pathLen > fromLen) && !memcmp(from, path, fromLen) && (path[fromLen] == '/')) return cJSON_Structure_Error;
+        if ((pathLen == fromLen) && !memcmp(from, path, fromLen)) return (cJSON_Patch_Get(GObjPtr, from, fromLen, token) != NULL) ? cJSON_Ok : cJSON_NotFound_Error;
+
+        result = cJSON_Patch_Remove(GObjPtr, from, fromLen, &moved, token);
+        if (result != cJSON_Ok) return result;
+
+        result = cJSON_Patch_Add(GObjPtr, path, pathLen, moved, token);
+        if (result != cJSON_Ok) cJSON_delGenObj(moved);
+        return result;
+    }
+    else if (!strcmp(op, "copy"))
+    {
+        if (from == NULL) return cJSON_Datatype_Error;
+
+        fromValue = cJSON_Patch_Get(GObjPtr, from, fromLen, token);
+        if (fromValue == NULL) return cJSON_NotFound_Error;
+
+        if (cJSON_clone(*fromValue, &valueCopy, NULL) != cJSON_Ok) return cJSON_NotAllocated_Error;
+
+        result = cJSON_Patch_Add(GObjPtr, path, pathLen, valueCopy, token);
+        if (result != cJSON_Ok) cJSON_delGenObj(valueCopy);
+        return result;
+    }
+    else if (!strcmp(op, "test"))
+    {
+        cJSON_Generic_t *target;
+
+        if (value == NULL) return cJSON_Datatype_Error;
+
+        target = cJSON_Patch_Get(GObjPtr, path, pathLen, token);
+        if (target == NULL) return cJSON_NotFound_Error;
+
+        return cJSON_equals(*target, *value) ? cJSON_Ok : cJSON_TestFailed_Error;
+    }
+
+    // Unknown operation
+    return cJSON_Datatype_Error;
+}
+
+#pragma endregion
+
+//   ---   Function Implementations   ---
+
+// - Patch Functions -
+#pragma region Patch Functions
+
+cJSON_Result_t cJSON_diff(cJSON_Generic_t oldObj, cJSON_Generic_t newObj, cJSON_Generic_t *patch)
+{
+    cJSON_SDB_t path = {0};
+    cJSON_Generic_t patchObj = mallocGenObj(List);
+    cJSON_Result_t result;
+
+    if (patchObj.dataContainer == NULL) return cJSON_NotAllocated_Error;
+
+    result = cJSON_Patch_DiffValue(oldObj, newObj, &path, patchObj);
+
+    SDB_Free(&path);
+
+    // Partial patches are discarded
+    if (result != cJSON_Ok)
+    {
+        cJSON_delGenObj(patchObj);
+        return result;
+    }
+
+    *patch = patchObj;
+    return cJSON_Ok;
+}
+
+cJSON_Result_t cJSON_applyPatch(cJSON_Generic_t *GObjPtr, cJSON_Generic_t patch)
+{
+    cJSON_SDB_t token = {0};
+    cJSON_Result_t result = cJSON_Ok;
+
+    if (patch.type != List) return cJSON_Datatype_Error;
+
+    for (cJSON_object_size_size_t i = 0; (i < AS_LIST_PTR(patch)->length) && (result == cJSON_Ok); i++)
+    {
+        if (AS_LIST_PTR(patch)->data[i].type != Dictionary)
+        {
+            result = cJSON_Datatype_Error;
+            break;
+        }
+
+        result = cJSON_Patch_ApplyOp(GObjPtr, AS_DICT_PTR(AS_LIST_PTR(patch)->data[i]), &token);
+    }
+
+    SDB_Free(&token);
+
+    return result;
+}
+
+#pragma endregion
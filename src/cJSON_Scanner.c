@@ -0,0 +1,505 @@
+/**
+ * @file cJSON_Scanner.c
+ * @author HeCoding180
+ * @brief cJSON library scanner source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include <string.h>
+
+#include "../inc/cJSON_Scanner.h"
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SCAN_USE_SSE2
+#endif
+
+//   ---   Macros   ---
+
+// - Bit Manipulation Macros -
+#pragma region Bit Manipulation Macros
+
+#if defined(__GNUC__) || defined(__clang__)
+/**
+ * @brief   Index of the lowest set bit of a non-zero mask.
+ *
+ */
+#define SCAN_CTZ(mask) ((unsigned)__builtin_ctz(mask))
+#else
+static unsigned SCAN_CTZ(unsigned mask)
+{
+    unsigned index = 0;
+    while (!(mask & 1u)) { mask >>= 1; index++; }
+    return index;
+}
+#endif
+
+#pragma endregion
+
+// - Minifier Table Macros -
+#pragma region Minifier Table Macros
+
+#if defined(__SSSE3__)
+// Shuffle table entry of an 8 bit keep mask: byte r holds the index of the r-th kept byte
+#define SCAN_BIT(m, j)          (((m) >> (j)) & 1U)
+#define SCAN_RANK(m, j)         (((j) > 0 ? SCAN_BIT(m, 0) : 0) + ((j) > 1 ? SCAN_BIT(m, 1) : 0) + ((j) > 2 ? SCAN_BIT(m, 2) : 0) + ((j) > 3 ? SCAN_BIT(m, 3) : 0) \
+                               + ((j) > 4 ? SCAN_BIT(m, 4) : 0) + ((j) > 5 ? SCAN_BIT(m, 5) : 0) + ((j) > 6 ? SCAN_BIT(m, 6) : 0))
+#define SCAN_PLACE(m, j)        (SCAN_BIT(m, j) ? ((uint64_t)(j) << (8 * SCAN_RANK(m, j))) : 0)
+#define SCAN_COMPACT(m)         (SCAN_PLACE(m, 0) | SCAN_PLACE(m, 1) | SCAN_PLACE(m, 2) | SCAN_PLACE(m, 3) | SCAN_PLACE(m, 4) | SCAN_PLACE(m, 5) | SCAN_PLACE(m, 6) | SCAN_PLACE(m, 7))
+#define SCAN_COUNT(m)           (SCAN_RANK(m, 7) + SCAN_BIT(m, 7))
+#define SCAN_TABLE4(F, m)       F(m), F((m) + 1), F((m) + 2), F((m) + 3)
+#define SCAN_TABLE16(F, m)      SCAN_TABLE4(F, m), SCAN_TABLE4(F, (m) + 4), SCAN_TABLE4(F, (m) + 8), SCAN_TABLE4(F, (m) + 12)
+#define SCAN_TABLE64(F, m)      SCAN_TABLE16(F, m), SCAN_TABLE16(F, (m) + 16), SCAN_TABLE16(F, (m) + 32), SCAN_TABLE16(F, (m) + 48)
+#define SCAN_TABLE256(F)        SCAN_TABLE64(F, 0), SCAN_TABLE64(F, 64), SCAN_TABLE64(F, 128), SCAN_TABLE64(F, 192)
+
+/**
+ * @brief   Byte compaction shuffles for all 8 bit keep masks.
+ *
+ */
+static const uint64_t SCAN_CompactTable[256] = { SCAN_TABLE256(SCAN_COMPACT) };
+/**
+ * @brief   Number of kept bytes for all 8 bit keep masks (POPCNT can't be assumed with SSSE3).
+ *
+ */
+static const uint8_t SCAN_CompactCount[256] = { SCAN_TABLE256(SCAN_COUNT) };
+#endif
+
+#pragma endregion
+
+//   ---   Function Implementations   ---
+
+// - Scanner Functions -
+#pragma region Scanner Functions
+
+const char* SCAN_SkipWhitespace(const char *ptr, const char *endPtr)
+{
+    // Most tokens are separated by zero or one whitespace characters, check those before entering the vectorized loop
+    if ((ptr >= endPtr) || !SCAN_IS_WHITESPACE(*ptr)) return ptr;
+    ptr++;
+    if ((ptr >= endPtr) || !SCAN_IS_WHITESPACE(*ptr)) return ptr;
+
+#ifdef SCAN_USE_SSE2
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i carriageReturn = _mm_set1_epi8('\r');
+
+    // Check 16 characters at once (indentation runs)
+    while ((endPtr - ptr) >= 16)
+    {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)ptr);
+        __m128i isWhitespace = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)),
+                                            _mm_or_si128(_mm_cmpeq_epi8(chunk, newline), _mm_cmpeq_epi8(chunk, carriageReturn)));
+        unsigned mask = ~((unsigned)_mm_movemask_epi8(isWhitespace)) & 0xFFFFu;
+
+        if (mask) return ptr + SCAN_CTZ(mask);
+        ptr += 16;
+    }
+#endif
+
+    while ((ptr < endPtr) && SCAN_IS_WHITESPACE(*ptr)) ptr++;
+
+    return ptr;
+}
+const char* SCAN_StringRun(const char *ptr, const char *endPtr)
+{
+#ifdef SCAN_USE_SSE2
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i controlMax = _mm_set1_epi8(0x1F);
+
+    while ((endPtr - ptr) >= 16)
+    {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)ptr);
+        // Unsigned "chunk <= 0x1F" is evaluated as min(chunk, 0x1F) == chunk
+        __m128i isSpecial = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+                                         _mm_cmpeq_epi8(_mm_min_epu8(chunk, controlMax), chunk));
+        unsigned mask = (unsigned)_mm_movemask_epi8(isSpecial);
+
+        if (mask) return ptr + SCAN_CTZ(mask);
+        ptr += 16;
+    }
+#endif
+
+    while ((ptr < endPtr) && (*ptr != '"') && (*ptr != '\\') && ((unsigned char)*ptr >= 0x20)) ptr++;
+
+    return ptr;
+}
+
+/**
+ * @brief   Scalar minifier, processes len characters of src and writes the kept ones to dst (dst <= src). Returns the number of written characters.
+ *
+ */
+static size_t SCAN_MinifyScalar(char *dst, const char *src, size_t len, bool *inString, bool *escape)
+{
+    char *startPtr = dst;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        char c = src[i];
+
+        if (*inString)
+        {
+            *dst++ = c;
+
+            if (*escape)            *escape = false;
+            else if (c == '\\')     *escape = true;
+            else if (c == '"')      *inString = false;
+        }
+        else if (!SCAN_IS_WHITESPACE(c))
+        {
+            *dst++ = c;
+
+            if (c == '"') *inString = true;
+        }
+    }
+
+    return (size_t)(dst - startPtr);
+}
+
+size_t SCAN_Minify(char *buf, size_t len, bool *inString, bool *escape)
+{
+    char *dst = buf;
+    size_t i = 0;
+
+#ifdef SCAN_USE_SSE2
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i carriageReturn = _mm_set1_epi8('\r');
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+
+    // Writes never pass the block that has just been loaded, so the data can be compacted in place
+    for (; (len - i) >= 16; i += 16)
+    {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(buf + i));
+
+        unsigned backslashMask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, backslash));
+        unsigned quoteMask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quote));
+        unsigned whitespaceMask = (unsigned)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)),
+                                                                           _mm_or_si128(_mm_cmpeq_epi8(chunk, newline), _mm_cmpeq_epi8(chunk, carriageReturn))));
+        bool nextEscape = false;
+
+        if (backslashMask || *escape)
+        {
+            // Backslash runs: every odd backslash of a run escapes the following character (Langdale & Lemire, "Parsing Gigabytes of JSON per Second")
+            unsigned carry = *escape ? 1U : 0U;
+            unsigned potentialEscape = backslashMask & ~carry;
+            unsigned escapeCode = (((potentialEscape << 1) | 0xAAAAAAAAU) - potentialEscape) ^ 0xAAAAAAAAU;
+            unsigned escapedMask = (escapeCode ^ (backslashMask | carry)) & 0xFFFFU;
+
+            nextEscape = ((escapeCode & backslashMask) & 0x8000U) != 0;
+            quoteMask &= ~escapedMask;
+        }
+
+        // Prefix XOR of the quote mask marks the characters from every opening quote up to (not including) its closing quote
+        unsigned stringMask = quoteMask;
+        stringMask ^= stringMask << 1;
+        stringMask ^= stringMask << 2;
+        stringMask ^= stringMask << 4;
+        stringMask ^= stringMask << 8;
+        bool quoteParity = (stringMask & 0x8000U) != 0;
+
+        if (*inString) stringMask = ~stringMask;
+        stringMask &= 0xFFFFU;
+
+        // Backslashes outside of strings aren't valid JSON, leave them to the scalar minifier so both paths treat them alike
+        if (backslashMask & ~stringMask)
+        {
+            dst += SCAN_MinifyScalar(dst, buf + i, 16, inString, escape);
+            continue;
+        }
+
+        // The last bit of the prefix XOR is the parity of the block's quotes
+        if (quoteParity) *inString = !*inString;
+        *escape = nextEscape;
+
+        unsigned keepMask = ~(whitespaceMask & ~stringMask) & 0xFFFFU;
+
+        if (keepMask == 0xFFFFU)
+        {
+            _mm_storeu_si128((__m128i*)dst, chunk);
+            dst += 16;
+            continue;
+        }
+
+#if defined(__SSSE3__)
+        // Compact each half using a shuffle from the table, the excess bytes are overwritten by the next store
+        __m128i lowShuffle = _mm_cvtsi64_si128((long long)SCAN_CompactTable[keepMask & 0xFFU]);
+        __m128i highShuffle = _mm_cvtsi64_si128((long long)SCAN_CompactTable[keepMask >> 8]);
+
+        _mm_storel_epi64((__m128i*)dst, _mm_shuffle_epi8(chunk, lowShuffle));
+        dst += SCAN_CompactCount[keepMask & 0xFFU];
+        _mm_storel_epi64((__m128i*)dst, _mm_shuffle_epi8(_mm_srli_si128(chunk, 8), highShuffle));
+        dst += SCAN_CompactCount[keepMask >> 8];
+#else
+        while (keepMask)
+        {
+            *dst++ = buf[i + SCAN_CTZ(keepMask)];
+            keepMask &= keepMask - 1;
+        }
+#endif
+    }
+#endif
+
+    dst += SCAN_MinifyScalar(dst, buf + i, len - i, inString, escape);
+
+    return (size_t)(dst - buf);
+}
+
+size_t SCAN_UTF8SequenceLength(const char *ptr, const char *endPtr)
+{
+    const unsigned char *bytes = (const unsigned char*)ptr;
+    size_t available = (size_t)(endPtr - ptr);
+
+    if (available == 0) return 0;
+
+    // ASCII
+    if (bytes[0] < 0x80) return 1;
+
+    // Two byte sequence (C2..DF), C0 and C1 would be overlong
+    if ((bytes[0] >= 0xC2) && (bytes[0] <= 0xDF))
+    {
+        return ((available >= 2) && ((bytes[1] & 0xC0) == 0x80)) ? 2 : 0;
+    }
+
+    // Three byte sequence (E0..EF), E0 requires A0..BF (overlong), ED requires 80..9F (surrogates)
+    if ((bytes[0] >= 0xE0) && (bytes[0] <= 0xEF))
+    {
+        if (available < 3) return 0;
+
+        unsigned char minSecond = (bytes[0] == 0xE0) ? 0xA0 : 0x80;
+        unsigned char maxSecond = (bytes[0] == 0xED) ? 0x9F : 0xBF;
+
+        return ((bytes[1] >= minSecond) && (bytes[1] <= maxSecond) && ((bytes[2] & 0xC0) == 0x80)) ? 3 : 0;
+    }
+
+    // Four byte sequence (F0..F4), F0 requires 90..BF (overlong), F4 requires 80..8F (above U+10FFFF)
+    if ((bytes[0] >= 0xF0) && (bytes[0] <= 0xF4))
+    {
+        if (available < 4) return 0;
+
+        unsigned char minSecond = (bytes[0] == 0xF0) ? 0x90 : 0x80;
+        unsigned char maxSecond = (bytes[0] == 0xF4) ? 0x8F : 0xBF;
+
+        return ((bytes[1] >= minSecond) && (bytes[1] <= maxSecond) && ((bytes[2] & 0xC0) == 0x80) && ((bytes[3] & 0xC0) == 0x80)) ? 4 : 0;
+    }
+
+    // Continuation byte or invalid lead byte
+    return 0;
+}
+
+/**
+ * @brief   Scalar UTF-8 validation, also used to locate the error after the vectorized validation failed.
+ *
+ */
+static bool SCAN_ValidateUTF8Scalar(const char *ptr, size_t len, size_t *errOffset)
+{
+    const char *startPtr = ptr;
+    const char *endPtr = ptr + len;
+
+    while (ptr < endPtr)
+    {
+        size_t seqLen = SCAN_UTF8SequenceLength(ptr, endPtr);
+
+        if (seqLen == 0)
+        {
+            if (errOffset != NULL) *errOffset = (size_t)(ptr - startPtr);
+            return false;
+        }
+
+        ptr += seqLen;
+    }
+
+    return true;
+}
+
+#if defined(__SSSE3__)
+
+// Error classes of the lookup based validation (Keiser & Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte")
+#define UTF8_TOO_SHORT      (1 << 0)
+#define UTF8_TOO_LONG       (1 << 1)
+#define UTF8_OVERLONG_3     (1 << 2)
+#define UTF8_TOO_LARGE      (1 << 3)
+#define UTF8_SURROGATE      (1 << 4)
+#define UTF8_OVERLONG_2     (1 << 5)
+#define UTF8_TOO_LARGE_1000 (1 << 6)
+#define UTF8_OVERLONG_4     (1 << 6)
+#define UTF8_TWO_CONTS      (1 << 7)
+#define UTF8_CARRY          (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS)
+
+/**
+ * @brief   Checks one 16 byte block against its predecessor, returns a non-zero vector if the block contains an error.
+ *
+ */
+static __m128i SCAN_UTF8CheckBlock(__m128i input, __m128i prevInput)
+{
+    const __m128i lowNibbleMask = _mm_set1_epi8(0x0F);
+
+    const __m128i byte1HighTable = _mm_setr_epi8(
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+        UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+        UTF8_TOO_SHORT,
+        UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+        UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4);
+    const __m128i byte1LowTable = _mm_setr_epi8(
+        UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+        UTF8_CARRY | UTF8_OVERLONG_2,
+        UTF8_CARRY,
+        UTF8_CARRY,
+        UTF8_CARRY | UTF8_TOO_LARGE,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000);
+    const __m128i byte2HighTable = _mm_setr_epi8(
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT);
+
+    // Previous bytes of every position (shifted in from the previous block)
+    __m128i prev1 = _mm_alignr_epi8(input, prevInput, 15);
+    __m128i prev2 = _mm_alignr_epi8(input, prevInput, 14);
+    __m128i prev3 = _mm_alignr_epi8(input, prevInput, 13);
+
+    // Two byte error patterns
+    __m128i byte1High = _mm_shuffle_epi8(byte1HighTable, _mm_and_si128(_mm_srli_epi16(prev1, 4), lowNibbleMask));
+    __m128i byte1Low = _mm_shuffle_epi8(byte1LowTable, _mm_and_si128(prev1, lowNibbleMask));
+    __m128i byte2High = _mm_shuffle_epi8(byte2HighTable, _mm_and_si128(_mm_srli_epi16(input, 4), lowNibbleMask));
+    __m128i specialCases = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+
+    // Third and fourth bytes of three and four byte sequences need to be continuation bytes
+    __m128i isThirdByte = _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xE0 - 1)));
+    __m128i isFourthByte = _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xF0 - 1)));
+    __m128i must23 = _mm_cmpgt_epi8(_mm_or_si128(isThirdByte, isFourthByte), _mm_setzero_si128());
+    __m128i must23Cont = _mm_and_si128(must23, _mm_set1_epi8((char)0x80));
+
+    return _mm_xor_si128(must23Cont, specialCases);
+}
+
+/**
+ * @brief   Returns a non-zero vector if the block ends with an incomplete sequence.
+ *
+ */
+static __m128i SCAN_UTF8IsIncomplete(__m128i input)
+{
+    const __m128i maxValue = _mm_setr_epi8(
+        (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF,
+        (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+
+    return _mm_subs_epu8(input, maxValue);
+}
+
+#endif
+
+bool SCAN_ValidateUTF8(const char *ptr, size_t len, size_t *errOffset)
+{
+#if defined(__SSSE3__)
+    __m128i error = _mm_setzero_si128();
+    __m128i prevInput = _mm_setzero_si128();
+    __m128i prevIncomplete = _mm_setzero_si128();
+    size_t offset = 0;
+
+    while (offset < len)
+    {
+        __m128i input;
+
+        if ((len - offset) >= 16)
+        {
+            input = _mm_loadu_si128((const __m128i*)(ptr + offset));
+        }
+        else
+        {
+            // Pad the tail with ASCII zeros
+            char tail[16] = {0};
+            memcpy(tail, ptr + offset, len - offset);
+            input = _mm_loadu_si128((const __m128i*)tail);
+        }
+
+        if (_mm_movemask_epi8(input) == 0)
+        {
+            // ASCII block, only a sequence left open by the previous block can be an error
+            error = _mm_or_si128(error, prevIncomplete);
+        }
+        else
+        {
+            error = _mm_or_si128(error, SCAN_UTF8CheckBlock(input, prevInput));
+            prevIncomplete = SCAN_UTF8IsIncomplete(input);
+        }
+
+        prevInput = input;
+        offset += 16;
+    }
+
+    error = _mm_or_si128(error, prevIncomplete);
+
+    // Locate the error using the scalar implementation
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) != 0xFFFF) return SCAN_ValidateUTF8Scalar(ptr, len, errOffset);
+
+    return true;
+#else
+    const char *startPtr = ptr;
+    const char *endPtr = ptr + len;
+
+#ifdef SCAN_USE_SSE2
+    // Skip ASCII blocks 16 bytes at a time, validate multi byte sequences using the scalar implementation
+    while ((endPtr - ptr) >= 16)
+    {
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)ptr));
+
+        if (mask == 0)
+        {
+            ptr += 16;
+            continue;
+        }
+
+        ptr += SCAN_CTZ(mask);
+
+        // Validate sequences until the next ASCII character
+        while ((ptr < endPtr) && ((unsigned char)*ptr >= 0x80))
+        {
+            size_t seqLen = SCAN_UTF8SequenceLength(ptr, endPtr);
+
+            if (seqLen == 0)
+            {
+                if (errOffset != NULL) *errOffset = (size_t)(ptr - startPtr);
+                return false;
+            }
+
+            ptr += seqLen;
+        }
+    }
+#endif
+
+    if (!SCAN_ValidateUTF8Scalar(ptr, (size_t)(endPtr - ptr), errOffset))
+    {
+        if (errOffset != NULL) *errOffset += (size_t)(ptr - startPtr);
+        return false;
+    }
+
+    return true;
+#endif
+}
+
+#pragma endregion
@@ -0,0 +1,177 @@
+/**
+ * @file cJSON_SourceSpan.c
+ * @author HeCoding180
+ * @brief cJSON library source span source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../inc/cJSON_Constants.h"
+#include "../inc/cJSON_SourceSpan.h"
+
+//   ---   Static Function Implementations   ---
+
+// - Span Table Helper Functions -
+#pragma region Span Table Helper Functions
+
+/**
+ * @brief   Makes sure the table can hold at least minCapacity spans.
+ *
+ */
+static bool SPAN_Reserve(cJSON_SpanTable_t *table, size_t minCapacity)
+{
+    if (minCapacity <= table->capacity) return true;
+
+    size_t newCapacity = (table->capacity > 0) ? table->capacity : CJSON_CONTAINER_INIT_CAPACITY;
+    while (newCapacity < minCapacity) newCapacity *= 2;
+
+    cJSON_SourceSpan_t *newSpans = (cJSON_SourceSpan_t*)realloc(table->spans, newCapacity * sizeof(cJSON_SourceSpan_t));
+    if (newSpans == NULL) return false;
+
+    table->spans = newSpans;
+    table->capacity = newCapacity;
+
+    return true;
+}
+
+/**
+ * @brief   Checks if the brackets of a span enclose the given range.
+ *
+ */
+static inline bool SPAN_Encloses(const cJSON_SourceSpan_t *span, size_t offset, size_t length)
+{
+    return (span->start < offset) && (offset + length < span->end);
+}
+
+#pragma endregion
+
+//   ---   Function Implementations   ---
+
+// - Span Table Functions -
+#pragma region Span Table Functions
+
+cJSON_SpanTable_t SPAN_Create(void)
+{
+    cJSON_SpanTable_t tempTable;
+
+    tempTable.spans = NULL;
+    tempTable.length = 0;
+    tempTable.capacity = 0;
+    tempTable.openSpan = CJSON_SPAN_NO_PARENT;
+
+    return tempTable;
+}
+void SPAN_Delete(cJSON_SpanTable_t *table)
+{
+    free(table->spans);
+
+    *table = SPAN_Create();
+}
+void SPAN_Clear(cJSON_SpanTable_t *table)
+{
+    table->length = 0;
+    table->openSpan = CJSON_SPAN_NO_PARENT;
+}
+
+bool SPAN_Open(cJSON_SpanTable_t *table, cJSON_Generic_t obj, size_t start)
+{
+    if (!SPAN_Reserve(table, table->length + 1)) return false;
+
+    cJSON_SourceSpan_t *span = &table->spans[table->length];
+    span->obj = obj;
+    span->start = start;
+    span->end = start;
+    span->parent = table->openSpan;
+    span->subtreeLength = 1;
+
+    table->openSpan = table->length++;
+
+    return true;
+}
+void SPAN_Close(cJSON_SpanTable_t *table, size_t end)
+{
+    cJSON_SourceSpan_t *span = &table->spans[table->openSpan];
+
+    // All spans pushed since the container was opened belong to its subtree
+    span->end = end;
+    span->subtreeLength = table->length - table->openSpan;
+
+    table->openSpan = span->parent;
+}
+
+size_t SPAN_FindEnclosing(const cJSON_SpanTable_t *table, size_t offset, size_t length)
+{
+    if ((table->length == 0) || !SPAN_Encloses(&table->spans[0], offset, length)) return CJSON_SPAN_NO_PARENT;
+
+    size_t index = 0;
+    bool descended = true;
+
+    // Descend into the enclosing child as long as there is one, children are visited in source order
+    while (descended)
+    {
+        size_t subtreeEnd = index + table->spans[index].subtreeLength;
+        descended = false;
+
+        for (size_t child = index + 1; (child < subtreeEnd) && (table->spans[child].start < offset); child += table->spans[child].subtreeLength)
+        {
+            if (SPAN_Encloses(&table->spans[child], offset, length))
+            {
+                index = child;
+                descended = true;
+                break;
+            }
+        }
+    }
+
+    return index;
+}
+bool SPAN_Splice(cJSON_SpanTable_t *table, size_t index, const cJSON_SpanTable_t *sub, ptrdiff_t delta)
+{
+    size_t oldLength = table->spans[index].subtreeLength;
+    size_t newLength = sub->length;
+
+    if (!SPAN_Reserve(table, table->length - oldLength + newLength)) return false;
+
+    cJSON_SourceSpan_t root = table->spans[index];
+    size_t tailIndex = index + newLength;
+    size_t tailLength = table->length - (index + oldLength);
+
+    // Move the spans behind the subtree, both their offsets and their parent indices shift
+    memmove(&table->spans[tailIndex], &table->spans[index + oldLength], tailLength * sizeof(cJSON_SourceSpan_t));
+    for (size_t i = tailIndex; i < tailIndex + tailLength; i++)
+    {
+        table->spans[i].start += delta;
+        table->spans[i].end += delta;
+        if ((table->spans[i].parent != CJSON_SPAN_NO_PARENT) && (table->spans[i].parent > index)) table->spans[i].parent = table->spans[i].parent - oldLength + newLength;
+    }
+
+    // Insert the reparsed subtree, the container itself keeps its object (contents are swapped in place)
+    for (size_t i = 0; i < newLength; i++)
+    {
+        cJSON_SourceSpan_t span = sub->spans[i];
+
+        span.start += root.start;
+        span.end += root.start;
+        span.parent = (i == 0) ? root.parent : (span.parent + index);
+
+        table->spans[index + i] = span;
+    }
+    table->spans[index].obj = root.obj;
+
+    // Enclosing containers grow by the edit
+    for (size_t i = root.parent; i != CJSON_SPAN_NO_PARENT; i = table->spans[i].parent)
+    {
+        table->spans[i].end += delta;
+        table->spans[i].subtreeLength = table->spans[i].subtreeLength - oldLength + newLength;
+    }
+
+    table->length = table->length - oldLength + newLength;
+
+    return true;
+}
+
+#pragma endregion
@@ -0,0 +1,46 @@
+/**
+ * @file cJSON_Stats.c
+ * @author HeCoding180
+ * @brief cJSON library stats source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include <string.h>
+
+#include "../inc/cJSON_Stats.h"
+
+//   ---   Variables   ---
+
+#ifdef CJSON_ENABLE_STATS
+_Thread_local cJSON_Stats_t cJSON_threadStats;
+#endif
+
+//   ---   Function Implementations   ---
+
+// - Stats Functions -
+#pragma region Stats Functions
+
+void cJSON_getStats(cJSON_Stats_t *stats)
+{
+#ifdef CJSON_ENABLE_STATS
+    *stats = cJSON_threadStats;
+
+    // Extrapolate the sampled ticks to all calls
+    for (unsigned i = 0; i < CJSON_STATS_PHASES; i++)
+    {
+        if (stats->sampledCalls[i] > 0) stats->cycles[i] = (uint64_t)((double)stats->cycles[i] * stats->calls[i] / stats->sampledCalls[i]);
+    }
+#else
+    memset(stats, 0, sizeof(cJSON_Stats_t));
+#endif
+}
+void cJSON_resetStats(void)
+{
+#ifdef CJSON_ENABLE_STATS
+    memset(&cJSON_threadStats, 0, sizeof(cJSON_Stats_t));
+#endif
+}
+
+#pragma endregion
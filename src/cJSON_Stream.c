@@ -0,0 +1,379 @@
+/**
+ * @file cJSON_Stream.c
+ * @author HeCoding180
+ * @brief cJSON library stream source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+// pread is POSIX, not part of strict ISO C (-std=c11)
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "../inc/cJSON.h"
+#include "../inc/cJSON_Parser_Util.h"
+#include "../inc/cJSON_Scanner.h"
+#include "../inc/cJSON_Stream.h"
+
+//   ---   Typedefs   ---
+
+// - Struct Typedefs -
+#pragma region Struct Typedefs
+
+/**
+ * @brief   Ring buffer shared by the reader thread and the parsing thread of cJSON_parseFilePipelined.
+ *
+ */
+typedef struct cJSON_Pipeline
+{
+    pthread_mutex_t lock;
+    pthread_cond_t filled;
+    pthread_cond_t freed;
+
+    int fd;
+    char *blocks;
+    size_t *blockLengths;
+    size_t blockSize;
+    size_t ringSize;
+
+    /**
+     * @brief   Number of blocks filled by the reader and released by the parser. Block n uses slot n % ringSize.
+     *
+     */
+    size_t produced;
+    size_t consumed;
+
+    bool eof;
+    bool readError;
+    /**
+     * @brief   Set by the parser if it doesn't need further blocks.
+     *
+     */
+    bool stop;
+} cJSON_Pipeline_t;
+
+#pragma endregion
+
+//   ---   Static Function Implementations   ---
+
+// - Incremental Parser Helper Functions -
+#pragma region Incremental Parser Helper Functions
+
+/**
+ * @brief   Checks if a character ends the preceding token.
+ *
+ */
+static inline bool cJSON_Stream_IsStructural(char c)
+{
+    return (c == '{') || (c == '}') || (c == '[') || (c == ']') || (c == ',') || (c == ':');
+}
+
+/**
+ * @brief   Finds the last structural character outside of strings of a chunk, continuing the lexical state of the previous chunks. Returns NULL if the chunk doesn't contain one.
+ *
+ */
+static const char* cJSON_Stream_LastBoundary(cJSON_IncParser_t *parser, const char *chunk, const char *endPtr, const char **firstPtr)
+{
+    const char *str = chunk;
+    const char *first = NULL;
+    const char *last = NULL;
+
+    while (str < endPtr)
+    {
+        if (parser->inString)
+        {
+            if (parser->escape)
+            {
+                parser->escape = false;
+                str++;
+                continue;
+            }
+
+            // Skip plain string contents
+            str = SCAN_StringRun(str, endPtr);
+            if (str == endPtr) break;
+
+            if (*str == '"')            parser->inString = false;
+            else if (*str == '\\')      parser->escape = true;
+        }
+        else if (*str == '"')
+        {
+            parser->inString = true;
+        }
+        else if (cJSON_Stream_IsStructural(*str))
+        {
+            if (first == NULL) first = str;
+            last = str;
+        }
+
+        str++;
+    }
+
+    *firstPtr = first;
+    return last;
+}
+
+/**
+ * @brief   Parses a range that ends with a structural character. Marks the parser as done once the root structure is closed.
+ *
+ */
+static cJSON_Result_t cJSON_Stream_ParseRange(cJSON_IncParser_t *parser, const char *str, const char *endPtr)
+{
+    cJSON_Result_t result = cJSON_Parser_Resume(&parser->ctx, &parser->root, &str, endPtr);
+
+    if ((result == cJSON_Ok) && cJSON_Parser_IsComplete(&parser->ctx, parser->root)) parser->done = true;
+
+    return result;
+}
+
+#pragma endregion
+
+// - Pipelined File Parser Helper Functions -
+#pragma region Pipelined File Parser Helper Functions
+
+/**
+ * @brief   Reader thread. Fills free slots of the ring with consecutive blocks of the file until the end of the file is reached or the parser stops.
+ *
+ */
+static void* cJSON_Pipeline_Reader(void *arg)
+{
+    cJSON_Pipeline_t *pipe = (cJSON_Pipeline_t*)arg;
+    off_t offset = 0;
+
+    while (true)
+    {
+        // Backpressure, wait for the parser to release a slot
+        pthread_mutex_lock(&pipe->lock);
+        while (((pipe->produced - pipe->consumed) == pipe->ringSize) && !pipe->stop) pthread_cond_wait(&pipe->freed, &pipe->lock);
+        size_t slot = pipe->produced % pipe->ringSize;
+        bool stop = pipe->stop;
+        pthread_mutex_unlock(&pipe->lock);
+
+        if (stop) break;
+
+        // The slot is owned by the reader until it is published, read without holding the lock
+        char *block = pipe->blocks + slot * pipe->blockSize;
+        size_t length = 0;
+        bool readError = false;
+
+        while (length < pipe->blockSize)
+        {
+            ssize_t bytesRead = pread(pipe->fd, block + length, pipe->blockSize - length, offset + (off_t)length);
+
+            if (bytesRead > 0)
+            {
+                length += (size_t)bytesRead;
+            }
+            else if (bytesRead == 0)
+            {
+                break;
+            }
+            else if (errno != EINTR)
+            {
+                readError = true;
+                break;
+            }
+        }
+        offset += (off_t)length;
+
+        pthread_mutex_lock(&pipe->lock);
+        if (length > 0)
+        {
+            pipe->blockLengths[slot] = length;
+            pipe->produced++;
+        }
+        if (length < pipe->blockSize)
+        {
+            pipe->eof = true;
+            pipe->readError = readError;
+        }
+        pthread_cond_signal(&pipe->filled);
+        pthread_mutex_unlock(&pipe->lock);
+
+        if (length < pipe->blockSize) break;
+    }
+
+    return NULL;
+}
+
+#pragma endregion
+
+//   ---   Function Implementations   ---
+
+// - Incremental Parser Functions -
+#pragma region Incremental Parser Functions
+
+cJSON_IncParser_t cJSON_createIncParser(void)
+{
+    cJSON_IncParser_t tempParser;
+
+    tempParser.ctx = cJSON_createParseContext(false);
+    tempParser.root.type = NullType;
+    tempParser.root.dataContainer = NULL;
+    tempParser.carry = (cJSON_SDB_t){ 0 };
+    tempParser.inString = false;
+    tempParser.escape = false;
+    tempParser.done = false;
+    tempParser.error = cJSON_Ok;
+
+    return tempParser;
+}
+void cJSON_deleteIncParser(cJSON_IncParser_t *parser)
+{
+    cJSON_delGenObj(parser->root);
+    parser->root.type = NullType;
+    parser->root.dataContainer = NULL;
+
+    SDB_Free(&parser->carry);
+    cJSON_deleteParseContext(&parser->ctx);
+}
+
+cJSON_Result_t cJSON_incParserFeed(cJSON_IncParser_t *parser, const char *chunk, size_t len)
+{
+    if ((parser->error != cJSON_Ok) || parser->done) return parser->error;
+
+    const char *endPtr = chunk + len;
+    const char *first;
+    const char *last = cJSON_Stream_LastBoundary(parser, chunk, endPtr, &first);
+
+    // No token ends within the chunk, keep all of it
+    if (last == NULL)
+    {
+        SDB_AddChars(&parser->carry, chunk, len);
+        return cJSON_Ok;
+    }
+
+    cJSON_Result_t result = cJSON_Ok;
+
+    // Complete the carried token using the chunk's head, then parse the chunk in place up to its last boundary
+    if (parser->carry.bufferSize > 0)
+    {
+        SDB_AddChars(&parser->carry, chunk, first + 1 - chunk);
+        result = cJSON_Stream_ParseRange(parser, SDB_GetStr(&parser->carry), SDB_GetStr(&parser->carry) + parser->carry.bufferSize);
+        SDB_Reset(&parser->carry);
+
+        chunk = first + 1;
+    }
+    if ((result == cJSON_Ok) && !parser->done) result = cJSON_Stream_ParseRange(parser, chunk, last + 1);
+
+    // Trailing data behind the root structure is ignored
+    if ((result == cJSON_Ok) && !parser->done) SDB_AddChars(&parser->carry, last + 1, endPtr - (last + 1));
+
+    parser->error = result;
+
+    return result;
+}
+cJSON_Result_t cJSON_incParserFinish(cJSON_IncParser_t *parser, cJSON_Generic_t *GObjPtr)
+{
+    if ((parser->error == cJSON_Ok) && !parser->done) parser->error = cJSON_Structure_Error;
+    if (parser->error != cJSON_Ok) return parser->error;
+
+    // Ownership is passed to the caller
+    *GObjPtr = parser->root;
+    parser->root.type = NullType;
+    parser->root.dataContainer = NULL;
+
+    return cJSON_Ok;
+}
+
+#pragma endregion
+
+// - Pipelined File Parser Functions -
+#pragma region Pipelined File Parser Functions
+
+cJSON_Result_t cJSON_parseFilePipelined(const char *fileName, cJSON_Generic_t *GObjPtr, const cJSON_PipelineOptions_t *opts)
+{
+    cJSON_Pipeline_t pipe;
+
+    pipe.blockSize = ((opts != NULL) && (opts->blockSize > 0)) ? opts->blockSize : CJSON_PIPELINE_BLOCK_SIZE;
+    pipe.ringSize = ((opts != NULL) && (opts->ringSize > 0)) ? opts->ringSize : CJSON_PIPELINE_RING_SIZE;
+    pipe.produced = 0;
+    pipe.consumed = 0;
+    pipe.eof = false;
+    pipe.readError = false;
+    pipe.stop = false;
+
+    pipe.fd = open(fileName, O_RDONLY);
+    if (pipe.fd < 0) return cJSON_NotFound_Error;
+
+    // Hint sequential access, lets the kernel read ahead of the reader thread
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(pipe.fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    pipe.blocks = (char*)malloc(pipe.ringSize * pipe.blockSize);
+    pipe.blockLengths = (size_t*)malloc(pipe.ringSize * sizeof(size_t));
+    if ((pipe.blocks == NULL) || (pipe.blockLengths == NULL))
+    {
+        free(pipe.blocks);
+        free(pipe.blockLengths);
+        close(pipe.fd);
+        return cJSON_NotAllocated_Error;
+    }
+
+    pthread_mutex_init(&pipe.lock, NULL);
+    pthread_cond_init(&pipe.filled, NULL);
+    pthread_cond_init(&pipe.freed, NULL);
+
+    cJSON_IncParser_t parser = cJSON_createIncParser();
+    cJSON_Result_t result = cJSON_Ok;
+    pthread_t reader;
+
+    if (pthread_create(&reader, NULL, cJSON_Pipeline_Reader, &pipe) != 0)
+    {
+        result = cJSON_Unknown_Error;
+    }
+    else
+    {
+        while (true)
+        {
+            // Wait for the next block
+            pthread_mutex_lock(&pipe.lock);
+            while ((pipe.consumed == pipe.produced) && !pipe.eof) pthread_cond_wait(&pipe.filled, &pipe.lock);
+            bool available = (pipe.consumed != pipe.produced);
+            bool readError = pipe.readError;
+            pthread_mutex_unlock(&pipe.lock);
+
+            if (!available)
+            {
+                if (readError) result = cJSON_Unknown_Error;
+                break;
+            }
+
+            // The reader doesn't touch a published slot until it is released
+            size_t slot = pipe.consumed % pipe.ringSize;
+            result = cJSON_incParserFeed(&parser, pipe.blocks + slot * pipe.blockSize, pipe.blockLengths[slot]);
+
+            pthread_mutex_lock(&pipe.lock);
+            pipe.consumed++;
+            if ((result != cJSON_Ok) || parser.done) pipe.stop = true;
+            pthread_cond_signal(&pipe.freed);
+            pthread_mutex_unlock(&pipe.lock);
+
+            if (pipe.stop) break;
+        }
+
+        pthread_join(reader, NULL);
+    }
+
+    if (result == cJSON_Ok) result = cJSON_incParserFinish(&parser, GObjPtr);
+
+    cJSON_deleteIncParser(&parser);
+
+    pthread_cond_destroy(&pipe.freed);
+    pthread_cond_destroy(&pipe.filled);
+    pthread_mutex_destroy(&pipe.lock);
+    free(pipe.blocks);
+    free(pipe.blockLengths);
+    close(pipe.fd);
+
+    return result;
+}
+
+#pragma endregion
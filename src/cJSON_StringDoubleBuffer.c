@@ -4,81 +4,85 @@
  * @brief Source file of the cJSON string double buffer
  * @version 0.1.0
  * @date 2024-09-03
- * 
+ *
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "../inc/cJSON_StringDoubleBuffer.h"
 
+//   ---   Static Function Implementations    ---
+
+/**
+ * @brief   Grows the buffer's capacity, so that at least minFree more characters plus a string terminator fit into it.
+ *
+ */
+static void SDB_Grow(cJSON_SDB_t *SDb, size_t minFree)
+{
+    size_t newCapacity = (SDb->bufferCapacity > 0) ? SDb->bufferCapacity : CJSON_PARSE_STRING_INIT_SIZE;
+
+    // Double capacity until the requested characters and the string terminator fit
+    while (newCapacity < SDb->bufferSize + minFree + 1) newCapacity *= 2;
+
+    SDb->buffer = (char*)realloc(SDb->buffer, newCapacity);
+    SDb->bufferCapacity = newCapacity;
+}
+
 //   ---   Function Implementations    ---
 
 void SDB_AddChar(cJSON_SDB_t *SDb, const char c)
 {
-    // Add char to preBuffer
-    SDb->preBuffer[SDb->preBufferSize++] = c;
+    // Check if buffer is full (one byte is always kept for the string terminator)
+    if (SDb->bufferSize + 1 >= SDb->bufferCapacity) SDB_Grow(SDb, 1);
 
-    // Check if preBuffer is full
-    if (SDb->preBufferSize >= CJSON_PARSE_STRING_PB_SIZE)
-    {
-        // Reallocate buffer memory and append prebuffer contents to buffer
-        if (SDb->bufferSize > 0)   SDb->buffer = (char*)realloc(SDb->buffer, SDb->bufferSize + CJSON_PARSE_STRING_PB_SIZE);
-        else                       SDb->buffer = (char*)malloc(CJSON_PARSE_STRING_PB_SIZE);
-        memcpy(&SDb->buffer[SDb->bufferSize], SDb->preBuffer, CJSON_PARSE_STRING_PB_SIZE);
-
-        // Update buffer sizes
-        SDb->bufferSize += CJSON_PARSE_STRING_PB_SIZE;
-        SDb->preBufferSize = 0;
-    }
+    SDb->buffer[SDb->bufferSize++] = c;
+}
+void SDB_AddChars(cJSON_SDB_t *SDb, const char *chars, size_t count)
+{
+    if (SDb->bufferSize + count >= SDb->bufferCapacity) SDB_Grow(SDb, count);
+
+    memcpy(&SDb->buffer[SDb->bufferSize], chars, count);
+    SDb->bufferSize += count;
+}
+
+const char* SDB_GetStr(cJSON_SDB_t *SDb)
+{
+    if (SDb->bufferCapacity == 0) SDB_Grow(SDb, 0);
+
+    // Terminate string, the terminator is not part of the buffer's size
+    SDb->buffer[SDb->bufferSize] = '\0';
+
+    return SDb->buffer;
 }
 
 char* SDB_BuildString(cJSON_SDB_t SDb)
 {
-    char *OutBuffer;
+    // Allocate output buffer memory, copy contents and append string terminator
+    char *OutBuffer = (char*)malloc(1 + SDb.bufferSize);
+    if (OutBuffer == NULL) return NULL;
 
-    if (SDb.bufferSize)
-    {
-        if (SDb.preBufferSize)   // Both pre-buffer and buffer contain data
-        {
-            // Allocate output buffer memory and append prebuffer and string terminator
-            OutBuffer = (char*)malloc(1 + SDb.bufferSize + SDb.preBufferSize);
-            memcpy(&OutBuffer, SDb.buffer, SDb.bufferSize);
-            memcpy(&OutBuffer[SDb.bufferSize], SDb.preBuffer, SDb.preBufferSize);
-            OutBuffer[SDb.bufferSize + SDb.preBufferSize] = '\0';
-        }
-        else                        // Only the buffer contains data
-        {
-            // Reallocate buffer memory and append string terminator
-            OutBuffer = (char*)malloc(1 + SDb.bufferSize);
-            memcpy(&OutBuffer, SDb.buffer, SDb.bufferSize);
-            OutBuffer[SDb.bufferSize] = '\0';
-        }
-    }
-    else
-    {
-        if (SDb.preBufferSize)   // Only the pre-buffer contains data
-        {
-            // Allocate buffer memory, copy contents from pre-buffer to buffer and append string terminator
-            OutBuffer = (char*)malloc(1 + SDb.preBufferSize);
-            memcpy(OutBuffer, SDb.preBuffer, SDb.preBufferSize);
-            OutBuffer[SDb.preBufferSize] = '\0';
-        }
-        else                        // Neither of the two buffer contains data
-        {
-            // Allocate 1 byte and set it to string terminator
-            OutBuffer = (char*)malloc(1);
-            OutBuffer[0] = '\0';
-        }
-    }
+    if (SDb.bufferSize) memcpy(OutBuffer, SDb.buffer, SDb.bufferSize);
+    OutBuffer[SDb.bufferSize] = '\0';
+
+    return OutBuffer;
 }
 
+void SDB_Reset(cJSON_SDB_t *SDb)
+{
+    // Keep allocated memory, only discard contents
+    SDb->bufferSize = 0;
+}
 void SDB_Free(cJSON_SDB_t *SDb)
 {
     // Check if any memory has been allocated
-    if (SDb->bufferSize > 0)
+    if (SDb->bufferCapacity > 0)
     {
         // Free buffer memory
         free(SDb->buffer);
-        SDb->bufferSize = 0;
     }
+
+    SDb->buffer = NULL;
+    SDb->bufferSize = 0;
+    SDb->bufferCapacity = 0;
 }
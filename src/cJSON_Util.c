@@ -7,26 +7,271 @@
  * 
  */
 
+#include "../inc/cJSON_Hash.h"
+#include "../inc/cJSON_Stats.h"
 #include "../inc/cJSON_Util.h"
 
+//   ---   Static Function Implementations   ---
+
+// - Capacity Helper Functions -
+#pragma region Capacity Helper Functions
+
+/**
+ * @brief   Size of a key array element in bytes (key pointer, inline key slot and key length).
+ *
+ */
+#define CJSON_KEY_SLOT_SIZE             (sizeof(cJSON_Key_t) + CJSON_KEY_INLINE_SIZE + sizeof(uint32_t))
+
+/**
+ * @brief   Returns the inline key slot of an entry, the slots follow the key pointers.
+ *
+ */
+static inline char* cJSON_inlineKey(const cJSON_Dict_t *dictPtr, size_t index)
+{
+    return (char*)(dictPtr->keyData + dictPtr->capacity) + index * CJSON_KEY_INLINE_SIZE;
+}
+/**
+ * @brief   Returns the key lengths of a dictionary, they follow the inline key slots.
+ *
+ */
+static inline uint32_t* cJSON_keyLengths(const cJSON_Dict_t *dictPtr)
+{
+    return (uint32_t*)cJSON_inlineKey(dictPtr, dictPtr->capacity);
+}
+
+/**
+ * @brief   Changes the capacity of a dictionary's key array. Inline keys are marked with NULL while their slots move and pointed to their new slots afterwards.
+ *
+ */
+static void cJSON_resizeDictKeys(cJSON_Arena_t *arena, cJSON_Dict_t *dictPtr, cJSON_object_size_size_t newCapacity)
+{
+    size_t oldCapacity = dictPtr->capacity;
+    size_t length = dictPtr->length;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        if (cJSON_isInlineKey(dictPtr, i)) dictPtr->keyData[i] = NULL;
+    }
+
+    // The slot and length regions start at multiples of the capacity, move them down before shrinking and up after growing (the upper region first, so it isn't overwritten)
+    if ((newCapacity < oldCapacity) && (length > 0))
+    {
+        char *base = (char*)dictPtr->keyData;
+
+        memmove(base + newCapacity * sizeof(cJSON_Key_t), base + oldCapacity * sizeof(cJSON_Key_t), length * CJSON_KEY_INLINE_SIZE);
+        memmove(base + newCapacity * (sizeof(cJSON_Key_t) + CJSON_KEY_INLINE_SIZE), base + oldCapacity * (sizeof(cJSON_Key_t) + CJSON_KEY_INLINE_SIZE), length * sizeof(uint32_t));
+    }
+
+    dictPtr->keyData = (cJSON_Key_t*)cJSON_realloc(arena, dictPtr->keyData, oldCapacity * CJSON_KEY_SLOT_SIZE, newCapacity * CJSON_KEY_SLOT_SIZE);
+
+    if ((newCapacity > oldCapacity) && (length > 0))
+    {
+        char *base = (char*)dictPtr->keyData;
+
+        memmove(base + newCapacity * (sizeof(cJSON_Key_t) + CJSON_KEY_INLINE_SIZE), base + oldCapacity * (sizeof(cJSON_Key_t) + CJSON_KEY_INLINE_SIZE), length * sizeof(uint32_t));
+        memmove(base + newCapacity * sizeof(cJSON_Key_t), base + oldCapacity * sizeof(cJSON_Key_t), length * CJSON_KEY_INLINE_SIZE);
+    }
+
+    dictPtr->capacity = newCapacity;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        if (dictPtr->keyData[i] == NULL) dictPtr->keyData[i] = cJSON_inlineKey(dictPtr, i);
+    }
+}
+
+/**
+ * @brief   Moves count keys from index src to index dst (ranges may overlap), inline keys move together with their slots.
+ *
+ */
+static void cJSON_moveDictKeys(cJSON_Dict_t *dictPtr, size_t dst, size_t src, size_t count)
+{
+    for (size_t i = src; i < src + count; i++)
+    {
+        if (cJSON_isInlineKey(dictPtr, i)) dictPtr->keyData[i] = NULL;
+    }
+
+    memmove(&dictPtr->keyData[dst], &dictPtr->keyData[src], count * sizeof(cJSON_Key_t));
+    memmove(cJSON_inlineKey(dictPtr, dst), cJSON_inlineKey(dictPtr, src), count * CJSON_KEY_INLINE_SIZE);
+    memmove(&cJSON_keyLengths(dictPtr)[dst], &cJSON_keyLengths(dictPtr)[src], count * sizeof(uint32_t));
+
+    for (size_t i = dst; i < dst + count; i++)
+    {
+        if (dictPtr->keyData[i] == NULL) dictPtr->keyData[i] = cJSON_inlineKey(dictPtr, i);
+    }
+}
+
+/**
+ * @brief   Halves the capacity of a heap allocated dictionary once at most a quarter of it is used. The gap between the grow and shrink thresholds keeps alternating inserts and removals amortized O(1).
+ *
+ */
+static void cJSON_shrinkDict(cJSON_Dict_t *dictPtr)
+{
+    if (dictPtr->arenaOwned) return;
+    if ((dictPtr->capacity <= CJSON_CONTAINER_INIT_CAPACITY) || (dictPtr->length > (dictPtr->capacity / 4))) return;
+
+    cJSON_object_size_size_t newCapacity = dictPtr->capacity / 2;
+
+    dictPtr->valueData = (cJSON_Generic_t*)realloc(dictPtr->valueData, newCapacity * sizeof(cJSON_Generic_t));
+    cJSON_resizeDictKeys(NULL, dictPtr, newCapacity);
+}
+/**
+ * @brief   Halves the capacity of a heap allocated list once at most a quarter of it is used.
+ *
+ */
+static void cJSON_shrinkList(cJSON_List_t *listPtr)
+{
+    if (listPtr->arenaOwned) return;
+    if ((listPtr->capacity <= CJSON_CONTAINER_INIT_CAPACITY) || (listPtr->length > (listPtr->capacity / 4))) return;
+
+    cJSON_object_size_size_t newCapacity = listPtr->capacity / 2;
+
+    listPtr->data = (cJSON_Generic_t*)realloc(listPtr->data, newCapacity * sizeof(cJSON_Generic_t));
+    listPtr->capacity = newCapacity;
+}
+
+#pragma endregion
+
+// - Sorted Key Helper Functions -
+#pragma region Sorted Key Helper Functions
+
+/**
+ * @brief   Sort entry, the key is only needed while sorting.
+ *
+ */
+typedef struct cJSON_SortEntry
+{
+    cJSON_SortedKey_t sortedKey;
+    const char *key;
+} cJSON_SortEntry_t;
+
+/**
+ * @brief   Returns the first 8 bytes of a key as a big-endian integer, zero padded. Integer order equals strcmp order of the first 8 bytes.
+ *
+ */
+static inline uint64_t cJSON_keyPrefix(const char *key, size_t length)
+{
+    uint64_t prefix = 0;
+
+    for (size_t i = 0; i < MIN(length, 8); i++) prefix |= (uint64_t)(uint8_t)key[i] << (56 - 8 * i);
+
+    return prefix;
+}
+
+/**
+ * @brief   Compares two keys (behind the common key prefix) with equal prefixes in strcmp order.
+ *
+ */
+static inline int cJSON_compareKeySuffix(const char *a, size_t aLength, const char *b, size_t bLength)
+{
+    // Keys of up to 8 bytes are fully contained in the prefix, the shorter key comes first
+    if ((aLength > 8) && (bLength > 8))
+    {
+        int cmp = memcmp(a + 8, b + 8, MIN(aLength, bLength) - 8);
+        if (cmp != 0) return cmp;
+    }
+
+    return (aLength > bLength) - (aLength < bLength);
+}
+
+/**
+ * @brief   qsort comparator, orders by key and then by original index (the first occurrence of a duplicate key comes first).
+ *
+ */
+static int cJSON_compareSortEntries(const void *a, const void *b)
+{
+    const cJSON_SortEntry_t *entryA = (const cJSON_SortEntry_t*)a;
+    const cJSON_SortEntry_t *entryB = (const cJSON_SortEntry_t*)b;
+
+    if (entryA->sortedKey.prefix != entryB->sortedKey.prefix) return (entryA->sortedKey.prefix < entryB->sortedKey.prefix) ? -1 : 1;
+
+    int cmp = cJSON_compareKeySuffix(entryA->key, entryA->sortedKey.length, entryB->key, entryB->sortedKey.length);
+    if (cmp != 0) return cmp;
+
+    return (entryA->sortedKey.index > entryB->sortedKey.index) - (entryA->sortedKey.index < entryB->sortedKey.index);
+}
+
+/**
+ * @brief   Binary search over a dictionary's sorted key table. The loop has no data dependent branches on the prefix comparison (it compiles to conditional moves), the full key is only compared if the prefixes match.
+ *
+ */
+static bool cJSON_findSortedKey(const cJSON_Dict_t *dictPtr, const char *key, size_t length, cJSON_object_size_size_t *index)
+{
+    if (dictPtr->length == 0) return false;
+
+    size_t offset = dictPtr->sortedKeysOffset;
+
+    // The common prefix is checked once, the search only looks at the bytes behind it
+    if ((length < offset) || memcmp(key, dictPtr->keyData[dictPtr->sortedKeys[0].index], offset)) return false;
+
+    key += offset;
+    length -= offset;
+
+    uint64_t prefix = cJSON_keyPrefix(key, length);
+    const cJSON_SortedKey_t *base = dictPtr->sortedKeys;
+    size_t n = dictPtr->length;
+
+    // Lower bound, base ends on the last entry less than the key (or the first entry)
+    while (n > 1)
+    {
+        size_t half = n / 2;
+        const cJSON_SortedKey_t *probe = &base[half];
+
+        bool less = (probe->prefix < prefix)
+                 || ((probe->prefix == prefix) && (cJSON_compareKeySuffix(dictPtr->keyData[probe->index] + offset, probe->length, key, length) < 0));
+
+        base = less ? probe : base;
+        n -= half;
+    }
+
+    if ((base->prefix < prefix) || ((base->prefix == prefix) && (cJSON_compareKeySuffix(dictPtr->keyData[base->index] + offset, base->length, key, length) < 0))) base++;
+
+    if ((base == dictPtr->sortedKeys + dictPtr->length) || (base->prefix != prefix) || (base->length != length)) return false;
+    if ((length > 8) && memcmp(dictPtr->keyData[base->index] + offset + 8, key + 8, length - 8)) return false;
+
+    *index = base->index;
+    return true;
+}
+
+#pragma endregion
+
 //   ---   Function Implementations   ---
 
 // - Memory Management Functions -
 #pragma region Memory Management Functions
 
+void* cJSON_alloc(cJSON_Arena_t *arena, size_t size)
+{
+    CJSON_STATS_ADD(allocs, 1);
+    CJSON_STATS_ADD(allocBytes, size);
+
+    if (arena != NULL) return ARENA_Alloc(arena, size);
+    else               return malloc(size);
+}
+void* cJSON_realloc(cJSON_Arena_t *arena, void *ptr, size_t oldSize, size_t newSize)
+{
+    CJSON_STATS_ADD(reallocs, 1);
+    CJSON_STATS_ADD(allocBytes, newSize);
+
+    if (arena != NULL) return ARENA_Realloc(arena, ptr, oldSize, newSize);
+    else               return realloc(ptr, newSize);
+}
+
 cJSON_Generic_t mallocGenObj(cJSON_ContainerType_t containerType)
+{
+    return allocGenObj(NULL, containerType);
+}
+cJSON_Generic_t allocGenObj(cJSON_Arena_t *arena, cJSON_ContainerType_t containerType)
 {
     cJSON_Generic_t genObj;
     genObj.type = containerType;
+    genObj.strSize = 0;
 
     size_t containerSize;
 
     // Select container pointer size
     switch(containerType)
     {
-    case NullType:
-        genObj.dataContainer = NULL;
-        return genObj;
     case Dictionary:
         containerSize = sizeof(cJSON_Dict_t);
         break;
@@ -35,6 +280,7 @@ cJSON_Generic_t mallocGenObj(cJSON_ContainerType_t containerType)
         break;
     case String:
         // Return object, no memory needs to be allocated, since a string is a pointer of itself and can be stored in the generic object on its own
+        genObj.dataContainer = NULL;
         return genObj;
     case Integer:
         containerSize = sizeof(cJSON_Int_t);
@@ -45,13 +291,30 @@ cJSON_Generic_t mallocGenObj(cJSON_ContainerType_t containerType)
     case Boolean:
         containerSize = sizeof(cJSON_Bool_t);
         break;
+    case IntArray:
+        containerSize = sizeof(cJSON_IntArray_t);
+        break;
+    case FloatArray:
+        containerSize = sizeof(cJSON_FloatArray_t);
+        break;
+    case NullType:
+    default:
+        genObj.dataContainer = NULL;
+        return genObj;
     }
 
     // Allocate memory for data container
-    genObj.dataContainer = malloc(containerSize);
+    genObj.dataContainer = cJSON_alloc(arena, containerSize);
     
     // Set allocated memory to 0
     if (genObj.dataContainer != NULL) memset(genObj.dataContainer, 0, containerSize);
+
+    // Arena containers must not be modified in place (see cJSON_tryAppendToDict and related functions)
+    if ((genObj.dataContainer != NULL) && (arena != NULL))
+    {
+        if (containerType == Dictionary)    AS_DICT_PTR(genObj)->arenaOwned = true;
+        else if (containerType == List)     AS_LIST_PTR(genObj)->arenaOwned = true;
+    }
     
     return genObj;
 }
@@ -61,45 +324,366 @@ cJSON_Generic_t mallocGenObj(cJSON_ContainerType_t containerType)
 // - Structural Functions -
 #pragma region Structural Functions
 
-void cJSON_appendToDict(cJSON_Dict_t *dictPtr, const cJSON_Key_t key, cJSON_Generic_t valObj)
+void cJSON_appendToDict(cJSON_Arena_t *arena, cJSON_Dict_t *dictPtr, const char *key, size_t keyLength, cJSON_Generic_t valObj)
 {
-    if (dictPtr->length > 0)
-    {
-        dictPtr->keyData = (cJSON_Key_t*)realloc(dictPtr->keyData, (1 + dictPtr->length) * sizeof(cJSON_Key_t));
-        dictPtr->valueData = (cJSON_Generic_t*)realloc(dictPtr->valueData, (1 + dictPtr->length) * sizeof(cJSON_Generic_t));
-    }
-    else
+    // Key index and sorted key table aren't maintained on mutation
+    dictPtr->keyIndex = NULL;
+    dictPtr->sortedKeys = NULL;
+
+    // Grow key and value arrays geometrically if dictionary is full
+    if (dictPtr->length >= dictPtr->capacity)
     {
-        dictPtr->keyData = (cJSON_Key_t*)malloc(sizeof(cJSON_Key_t));
-        dictPtr->valueData = (cJSON_Generic_t*)malloc(sizeof(cJSON_Generic_t));
+        cJSON_object_size_size_t newCapacity = (dictPtr->capacity > 0) ? (2 * dictPtr->capacity) : CJSON_CONTAINER_INIT_CAPACITY;
+
+        dictPtr->valueData = (cJSON_Generic_t*)cJSON_realloc(arena, dictPtr->valueData, dictPtr->capacity * sizeof(cJSON_Generic_t), newCapacity * sizeof(cJSON_Generic_t));
+        cJSON_resizeDictKeys(arena, dictPtr, newCapacity);
     }
 
-    // Allocate memory for key string and store key
-    dictPtr->keyData[dictPtr->length] = (cJSON_Key_t)malloc(1 + strlen(key));
-    strcpy(dictPtr->keyData[dictPtr->length], key);
+    // Store short keys in their inline slot, allocate memory for longer ones
+    size_t keySize = 1 + keyLength;
+    dictPtr->keyData[dictPtr->length] = (keySize <= CJSON_KEY_INLINE_SIZE) ? cJSON_inlineKey(dictPtr, dictPtr->length) : (cJSON_Key_t)cJSON_alloc(arena, keySize);
+    memcpy(dictPtr->keyData[dictPtr->length], key, keyLength);
+    dictPtr->keyData[dictPtr->length][keyLength] = '\0';
+    cJSON_keyLengths(dictPtr)[dictPtr->length] = (uint32_t)keyLength;
 
     // Store value object
     dictPtr->valueData[dictPtr->length] = valObj;
+    CJSON_STATS_ADD(appends, 1);
 
     // Update length
     dictPtr->length++;
 }
-void cJSON_appendToList(cJSON_List_t *listPtr, cJSON_Generic_t obj)
+void cJSON_appendToList(cJSON_Arena_t *arena, cJSON_List_t *listPtr, cJSON_Generic_t obj)
 {
-    if (listPtr->length > 0)
+    // Grow data array geometrically if list is full
+    if (listPtr->length >= listPtr->capacity)
     {
-        listPtr->data = (cJSON_Generic_t*)realloc(listPtr->data, (1 + listPtr->length) * sizeof(cJSON_Generic_t));
-    }
-    else
-    {
-        listPtr->data = (cJSON_Generic_t*)malloc(sizeof(cJSON_Generic_t));
+        cJSON_object_size_size_t newCapacity = (listPtr->capacity > 0) ? (2 * listPtr->capacity) : CJSON_CONTAINER_INIT_CAPACITY;
+
+        listPtr->data = (cJSON_Generic_t*)cJSON_realloc(arena, listPtr->data, listPtr->capacity * sizeof(cJSON_Generic_t), newCapacity * sizeof(cJSON_Generic_t));
+        listPtr->capacity = newCapacity;
     }
 
     // Store object in list
     listPtr->data[listPtr->length] = obj;
+    CJSON_STATS_ADD(appends, 1);
 
     // Update length
     listPtr->length++;
 }
 
+void cJSON_insertIntoDict(cJSON_Arena_t *arena, cJSON_Dict_t *dictPtr, cJSON_object_size_size_t index, const char *key, size_t keyLength, cJSON_Generic_t valObj)
+{
+    // Append to grow the arrays if needed, then rotate the new entry into place
+    cJSON_appendToDict(arena, dictPtr, key, keyLength, valObj);
+
+    if (index < dictPtr->length - 1)
+    {
+        cJSON_object_size_size_t last = dictPtr->length - 1;
+        cJSON_Key_t keyCopy = dictPtr->keyData[last];
+        bool keyInline = cJSON_isInlineKey(dictPtr, last);
+        char inlineCopy[CJSON_KEY_INLINE_SIZE];
+
+        // The new key's slot is overwritten by the move
+        if (keyInline) memcpy(inlineCopy, cJSON_inlineKey(dictPtr, last), CJSON_KEY_INLINE_SIZE);
+
+        cJSON_moveDictKeys(dictPtr, index + 1, index, last - index);
+        memmove(&dictPtr->valueData[index + 1], &dictPtr->valueData[index], (last - index) * sizeof(cJSON_Generic_t));
+
+        if (keyInline)
+        {
+            memcpy(cJSON_inlineKey(dictPtr, index), inlineCopy, CJSON_KEY_INLINE_SIZE);
+            keyCopy = cJSON_inlineKey(dictPtr, index);
+        }
+        dictPtr->keyData[index] = keyCopy;
+        cJSON_keyLengths(dictPtr)[index] = (uint32_t)keyLength;
+        dictPtr->valueData[index] = valObj;
+    }
+}
+void cJSON_insertIntoList(cJSON_Arena_t *arena, cJSON_List_t *listPtr, cJSON_object_size_size_t index, cJSON_Generic_t obj)
+{
+    // Append to grow the array if needed, then rotate the new item into place
+    cJSON_appendToList(arena, listPtr, obj);
+
+    if (index < listPtr->length - 1)
+    {
+        memmove(&listPtr->data[index + 1], &listPtr->data[index], (listPtr->length - 1 - index) * sizeof(cJSON_Generic_t));
+        listPtr->data[index] = obj;
+    }
+}
+cJSON_Generic_t cJSON_detachFromDict(cJSON_Dict_t *dictPtr, cJSON_object_size_size_t index)
+{
+    cJSON_Generic_t detachedObj = dictPtr->valueData[index];
+
+    cJSON_freeDictKey(dictPtr, index);
+    dictPtr->keyIndex = NULL;
+    dictPtr->sortedKeys = NULL;
+
+    // Close the gap, keep entry order
+    cJSON_moveDictKeys(dictPtr, index, index + 1, dictPtr->length - 1 - index);
+    memmove(&dictPtr->valueData[index], &dictPtr->valueData[index + 1], (dictPtr->length - 1 - index) * sizeof(cJSON_Generic_t));
+    dictPtr->length--;
+
+    cJSON_shrinkDict(dictPtr);
+
+    return detachedObj;
+}
+cJSON_Generic_t cJSON_detachFromList(cJSON_List_t *listPtr, cJSON_object_size_size_t index)
+{
+    cJSON_Generic_t detachedObj = listPtr->data[index];
+
+    // Close the gap, keep item order
+    memmove(&listPtr->data[index], &listPtr->data[index + 1], (listPtr->length - 1 - index) * sizeof(cJSON_Generic_t));
+    listPtr->length--;
+
+    cJSON_shrinkList(listPtr);
+
+    return detachedObj;
+}
+cJSON_Generic_t cJSON_swapDetachFromDict(cJSON_Dict_t *dictPtr, cJSON_object_size_size_t index)
+{
+    cJSON_Generic_t detachedObj = dictPtr->valueData[index];
+
+    cJSON_freeDictKey(dictPtr, index);
+    dictPtr->keyIndex = NULL;
+    dictPtr->sortedKeys = NULL;
+
+    // Move last entry into the gap
+    dictPtr->length--;
+    if (index < dictPtr->length) cJSON_moveDictKeys(dictPtr, index, dictPtr->length, 1);
+    dictPtr->valueData[index] = dictPtr->valueData[dictPtr->length];
+
+    cJSON_shrinkDict(dictPtr);
+
+    return detachedObj;
+}
+cJSON_Generic_t cJSON_swapDetachFromList(cJSON_List_t *listPtr, cJSON_object_size_size_t index)
+{
+    cJSON_Generic_t detachedObj = listPtr->data[index];
+
+    // Move last item into the gap
+    listPtr->length--;
+    listPtr->data[index] = listPtr->data[listPtr->length];
+
+    cJSON_shrinkList(listPtr);
+
+    return detachedObj;
+}
+
+bool cJSON_isInlineKey(const cJSON_Dict_t *dictPtr, cJSON_object_size_size_t index)
+{
+    return dictPtr->keyData[index] == cJSON_inlineKey(dictPtr, index);
+}
+void cJSON_freeDictKey(cJSON_Dict_t *dictPtr, cJSON_object_size_size_t index)
+{
+    if (!cJSON_isInlineKey(dictPtr, index)) free(dictPtr->keyData[index]);
+}
+size_t cJSON_getDictKeyLength(const cJSON_Dict_t *dictPtr, cJSON_object_size_size_t index)
+{
+    return cJSON_keyLengths(dictPtr)[index];
+}
+
+void cJSON_buildDictIndex(cJSON_Arena_t *arena, cJSON_Dict_t *dictPtr)
+{
+    uint32_t slotCount = 16;
+
+    while (slotCount < 2 * dictPtr->length) slotCount *= 2;
+
+    dictPtr->keyIndex = (uint32_t*)cJSON_alloc(arena, slotCount * sizeof(uint32_t));
+    if (dictPtr->keyIndex == NULL) return;
+
+    memset(dictPtr->keyIndex, 0, slotCount * sizeof(uint32_t));
+    dictPtr->keyIndexMask = slotCount - 1;
+
+    for (cJSON_object_size_size_t i = 0; i < dictPtr->length; i++)
+    {
+        uint32_t slot = (uint32_t)HASH_Bytes(dictPtr->keyData[i], cJSON_keyLengths(dictPtr)[i], 0) & dictPtr->keyIndexMask;
+
+        // Linear probing, the first occurrence of a duplicate key wins like in the linear search
+        while (dictPtr->keyIndex[slot] != 0) slot = (slot + 1) & dictPtr->keyIndexMask;
+        dictPtr->keyIndex[slot] = i + 1;
+    }
+}
+
+void cJSON_buildDictSortedKeys(cJSON_Arena_t *arena, cJSON_Dict_t *dictPtr)
+{
+    cJSON_SortEntry_t *entries = (cJSON_SortEntry_t*)malloc(dictPtr->length * sizeof(cJSON_SortEntry_t));
+    if (entries == NULL) return;
+
+    // Length of the prefix shared by all keys
+    size_t offset = (dictPtr->length > 0) ? cJSON_keyLengths(dictPtr)[0] : 0;
+    for (cJSON_object_size_size_t i = 1; i < dictPtr->length; i++)
+    {
+        size_t j = 0;
+        while ((j < MIN(offset, cJSON_keyLengths(dictPtr)[i])) && (dictPtr->keyData[i][j] == dictPtr->keyData[0][j])) j++;
+        offset = j;
+    }
+
+    for (cJSON_object_size_size_t i = 0; i < dictPtr->length; i++)
+    {
+        size_t length = cJSON_keyLengths(dictPtr)[i] - offset;
+
+        entries[i].sortedKey.prefix = cJSON_keyPrefix(dictPtr->keyData[i] + offset, length);
+        entries[i].sortedKey.length = (uint32_t)length;
+        entries[i].sortedKey.index = i;
+        entries[i].key = dictPtr->keyData[i] + offset;
+    }
+
+    qsort(entries, dictPtr->length, sizeof(cJSON_SortEntry_t), cJSON_compareSortEntries);
+
+    // Only the packed part is kept, the keys are reached through the permutation
+    dictPtr->sortedKeys = (cJSON_SortedKey_t*)cJSON_alloc(arena, dictPtr->length * sizeof(cJSON_SortedKey_t));
+    if (dictPtr->sortedKeys != NULL)
+    {
+        for (cJSON_object_size_size_t i = 0; i < dictPtr->length; i++) dictPtr->sortedKeys[i] = entries[i].sortedKey;
+        dictPtr->sortedKeysOffset = (uint32_t)offset;
+    }
+
+    free(entries);
+}
+
+bool cJSON_findDictKey(const cJSON_Dict_t *dictPtr, const char *key, cJSON_object_size_size_t hintIndex, cJSON_object_size_size_t *index)
+{
+    return cJSON_findDictKeyView(dictPtr, key, strlen(key), hintIndex, index);
+}
+bool cJSON_findDictKeyView(const cJSON_Dict_t *dictPtr, const char *key, size_t length, cJSON_object_size_size_t hintIndex, cJSON_object_size_size_t *index)
+{
+    const uint32_t *keyLengths = cJSON_keyLengths(dictPtr);
+
+    // Check hinted slot first
+    if ((hintIndex < dictPtr->length) && (keyLengths[hintIndex] == length) && !memcmp(dictPtr->keyData[hintIndex], key, length))
+    {
+        *index = hintIndex;
+        return true;
+    }
+
+    if (dictPtr->sortedKeys != NULL) return cJSON_findSortedKey(dictPtr, key, length, index);
+
+    if (dictPtr->keyIndex != NULL)
+    {
+        uint32_t slot = (uint32_t)HASH_Bytes(key, length, 0) & dictPtr->keyIndexMask;
+
+        while (dictPtr->keyIndex[slot] != 0)
+        {
+            cJSON_object_size_size_t i = dictPtr->keyIndex[slot] - 1;
+
+            if ((keyLengths[i] == length) && !memcmp(dictPtr->keyData[i], key, length))
+            {
+                *index = i;
+                return true;
+            }
+
+            slot = (slot + 1) & dictPtr->keyIndexMask;
+        }
+
+        return false;
+    }
+
+    // Stored lengths rule out most keys without touching them
+    for (cJSON_object_size_size_t i = 0; i < dictPtr->length; i++)
+    {
+        if ((keyLengths[i] == length) && !memcmp(dictPtr->keyData[i], key, length))
+        {
+            *index = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+#pragma endregion
+
+// - Packed Array Functions -
+#pragma region Packed Array Functions
+
+void cJSON_appendToIntArray(cJSON_Arena_t *arena, cJSON_IntArray_t *arrPtr, cJSON_Int_t intVal)
+{
+    // Grow data array geometrically if array is full
+    if (arrPtr->length >= arrPtr->capacity)
+    {
+        cJSON_object_size_size_t newCapacity = (arrPtr->capacity > 0) ? (2 * arrPtr->capacity) : CJSON_CONTAINER_INIT_CAPACITY;
+
+        arrPtr->data = (cJSON_Int_t*)cJSON_realloc(arena, arrPtr->data, arrPtr->capacity * sizeof(cJSON_Int_t), newCapacity * sizeof(cJSON_Int_t));
+        arrPtr->capacity = newCapacity;
+    }
+
+    arrPtr->data[arrPtr->length++] = intVal;
+    CJSON_STATS_ADD(appends, 1);
+}
+void cJSON_appendToFloatArray(cJSON_Arena_t *arena, cJSON_FloatArray_t *arrPtr, cJSON_Float_t floatVal)
+{
+    // Grow data array geometrically if array is full
+    if (arrPtr->length >= arrPtr->capacity)
+    {
+        cJSON_object_size_size_t newCapacity = (arrPtr->capacity > 0) ? (2 * arrPtr->capacity) : CJSON_CONTAINER_INIT_CAPACITY;
+
+        arrPtr->data = (cJSON_Float_t*)cJSON_realloc(arena, arrPtr->data, arrPtr->capacity * sizeof(cJSON_Float_t), newCapacity * sizeof(cJSON_Float_t));
+        arrPtr->capacity = newCapacity;
+    }
+
+    arrPtr->data[arrPtr->length++] = floatVal;
+    CJSON_STATS_ADD(appends, 1);
+}
+cJSON_Generic_t cJSON_unpackArray(cJSON_Arena_t *arena, cJSON_Generic_t arrObj)
+{
+    cJSON_Generic_t listObj = allocGenObj(arena, List);
+    cJSON_object_size_size_t length = cJSON_getListLength(arrObj);
+
+    if (length > 0)
+    {
+        AS_LIST_PTR(listObj)->data = (cJSON_Generic_t*)cJSON_alloc(arena, length * sizeof(cJSON_Generic_t));
+        AS_LIST_PTR(listObj)->capacity = length;
+    }
+
+    for (cJSON_object_size_size_t i = 0; i < length; i++)
+    {
+        cJSON_Generic_t numObj = allocGenObj(arena, (arrObj.type == IntArray) ? Integer : Float);
+
+        if (arrObj.type == IntArray)    AS_INT(numObj) = AS_INT_ARRAY_PTR(arrObj)->data[i];
+        else                            AS_FLOAT(numObj) = AS_FLOAT_ARRAY_PTR(arrObj)->data[i];
+
+        AS_LIST_PTR(listObj)->data[i] = numObj;
+    }
+    AS_LIST_PTR(listObj)->length = length;
+
+    // Both array types share their layout, arena memory is released with the arena
+    if (arena == NULL)
+    {
+        free(AS_INT_ARRAY_PTR(arrObj)->data);
+        free(arrObj.dataContainer);
+    }
+
+    return listObj;
+}
+
+cJSON_object_size_size_t cJSON_getListLength(cJSON_Generic_t listObj)
+{
+    if (listObj.type == IntArray)   return AS_INT_ARRAY_PTR(listObj)->length;
+    if (listObj.type == FloatArray) return AS_FLOAT_ARRAY_PTR(listObj)->length;
+
+    return AS_LIST_PTR(listObj)->length;
+}
+cJSON_Generic_t cJSON_getListItem(cJSON_Generic_t listObj, cJSON_object_size_size_t index)
+{
+    cJSON_Generic_t item = { .type = NullType, .strSize = 0, .dataContainer = NULL };
+
+    if (listObj.type == IntArray)
+    {
+        item.type = Integer;
+        item.dataContainer = &AS_INT_ARRAY_PTR(listObj)->data[index];
+    }
+    else if (listObj.type == FloatArray)
+    {
+        item.type = Float;
+        item.dataContainer = &AS_FLOAT_ARRAY_PTR(listObj)->data[index];
+    }
+    else
+    {
+        item = AS_LIST_PTR(listObj)->data[index];
+    }
+
+    return item;
+}
+
 #pragma endregion
@@ -0,0 +1,213 @@
+/**
+ * @file cJSON_Validator.c
+ * @author HeCoding180
+ * @brief cJSON library validator source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include "../inc/cJSON_Validator.h"
+#include "../inc/cJSON_Parser_Util.h"
+#include "../inc/cJSON_Scanner.h"
+
+//   ---   Macros   ---
+
+/**
+ * @brief   Number of bytes of the container type bit stack (one bit per depth level, set for dictionaries).
+ *
+ */
+#define CJV_CONTAINER_BITS_SIZE ((CJSON_MAX_DEPTH / 8) + 1)
+
+//   ---   Function Implementations   ---
+
+// - Validator Functions -
+#pragma region Validator Functions
+
+cJSON_Result_t cJSON_validate(const char *ptr, size_t len, size_t *errOffset)
+{
+    const char *str = ptr;
+    const char *endPtr = ptr + len;
+
+    // Container type stack, one bit per depth level (set: dictionary, cleared: list)
+    uint8_t containerBits[CJV_CONTAINER_BITS_SIZE] = {0};
+    size_t depth = 0;
+
+    cJSON_Result_t result = cJSON_Ok;
+    uint8_t pFlags = 0;
+
+    // Root structure, leading characters are skipped like the parser does
+    while ((str < endPtr) && (*str != '{') && (*str != '[')) str++;
+
+    if (str < endPtr)
+    {
+        if (*str == '{')
+        {
+            containerBits[0] = 1;
+            pFlags = CJP_DICT_END_POSSIBLE | CJP_DICT_KEY_POSSIBLE;
+        }
+        else
+        {
+            pFlags = CJP_LIST_END_POSSIBLE | CJP_LIST_VALUE_POSSIBLE;
+        }
+
+        depth = 1;
+        str++;
+    }
+    else
+    {
+        result = cJSON_Structure_Error;
+    }
+
+    while ((result == cJSON_Ok) && (depth > 0))
+    {
+        str = SCAN_SkipWhitespace(str, endPtr);
+
+        if (str >= endPtr)
+        {
+            // End of data reached before the root structure was closed
+            result = cJSON_Structure_Error;
+            break;
+        }
+
+        switch (*str)
+        {
+        case '{':
+        case '[':
+            // Check if start container is possible
+            if (!(pFlags & (CJP_DICT_VALUE_POSSIBLE | CJP_LIST_VALUE_POSSIBLE)))
+            {
+                result = cJSON_Structure_Error;
+                break;
+            }
+
+            // Check if JSON structure is within depth range
+            if (depth >= CJSON_MAX_DEPTH)
+            {
+                result = cJSON_DepthOutOfRange_Error;
+                break;
+            }
+
+            if (*str == '{')
+            {
+                containerBits[depth / 8] |= (uint8_t)(1u << (depth % 8));
+                pFlags = CJP_DICT_END_POSSIBLE | CJP_DICT_KEY_POSSIBLE;
+            }
+            else
+            {
+                containerBits[depth / 8] &= (uint8_t)~(1u << (depth % 8));
+                pFlags = CJP_LIST_END_POSSIBLE | CJP_LIST_VALUE_POSSIBLE;
+            }
+
+            depth++;
+            break;
+        case '}':
+        case ']':
+            // Check if end of container is possible
+            if (!(pFlags & ((*str == '}') ? CJP_DICT_END_POSSIBLE : CJP_LIST_END_POSSIBLE)))
+            {
+                result = cJSON_Structure_Error;
+                break;
+            }
+
+            depth--;
+
+            if (depth == 0)                                         pFlags = 0;
+            else if (containerBits[(depth - 1) / 8] & (1u << ((depth - 1) % 8)))   pFlags = CJP_DICT_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
+            else                                                    pFlags = CJP_LIST_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
+            break;
+        case ',':
+            // Item separator, check if allowed
+            if (!(pFlags & CJP_ITEM_SEPT_POSSIBLE))
+            {
+                result = cJSON_Structure_Error;
+                break;
+            }
+
+            if (containerBits[(depth - 1) / 8] & (1u << ((depth - 1) % 8)))  pFlags = CJP_DICT_KEY_POSSIBLE;
+            else                                                            pFlags = CJP_LIST_VALUE_POSSIBLE;
+            break;
+        case ':':
+            // Dictionary key-value separator, check if allowed
+            if (!(pFlags & CJP_DICT_SEPT_POSSIBLE))
+            {
+                result = cJSON_Structure_Error;
+                break;
+            }
+
+            pFlags = CJP_DICT_VALUE_POSSIBLE;
+            break;
+        case '"':
+            // String is either a dictionary key or a value
+            if (!(pFlags & (CJP_DICT_KEY_POSSIBLE | CJP_DICT_VALUE_POSSIBLE | CJP_LIST_VALUE_POSSIBLE)))
+            {
+                result = cJSON_Structure_Error;
+                break;
+            }
+
+            result = cJSON_Parser_SkipString(&str, endPtr);
+
+            if (pFlags & CJP_DICT_KEY_POSSIBLE)             pFlags = CJP_DICT_SEPT_POSSIBLE;
+            else if (pFlags & CJP_DICT_VALUE_POSSIBLE)      pFlags = CJP_DICT_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
+            else                                            pFlags = CJP_LIST_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
+            break;
+        default:;
+            // Scalar values: number, true, false, null
+            size_t tokenLen = 0;
+
+            if ((*str == '-') || ((*str >= '0') && (*str <= '9')))
+            {
+                if (!(pFlags & (CJP_DICT_VALUE_POSSIBLE | CJP_LIST_VALUE_POSSIBLE)))
+                {
+                    result = cJSON_Structure_Error;
+                    break;
+                }
+
+                tokenLen = cJSON_Parser_ScanNumber(str, endPtr, NULL);
+                if (tokenLen > CJSON_MAX_NUM_LEN) tokenLen = 0;
+            }
+            else if ((*str == 't') || (*str == 'T') || (*str == 'f') || (*str == 'F') || (*str == 'n') || (*str == 'N'))
+            {
+                // Literals are matched before their location is checked, like the parser does, so malformed literals are reported as such
+                if (cJSON_Parser_MatchLiteral(str, endPtr, "true", 4))          tokenLen = 4;
+                else if (cJSON_Parser_MatchLiteral(str, endPtr, "false", 5))    tokenLen = 5;
+                else if (cJSON_Parser_MatchLiteral(str, endPtr, "null", 4))     tokenLen = 4;
+
+                if ((tokenLen != 0) && !(pFlags & (CJP_DICT_VALUE_POSSIBLE | CJP_LIST_VALUE_POSSIBLE)))
+                {
+                    str += tokenLen - 1;
+                    result = cJSON_Structure_Error;
+                    break;
+                }
+            }
+            else
+            {
+                // Unknown character
+                result = cJSON_Structure_Error;
+                break;
+            }
+
+            if (tokenLen == 0)
+            {
+                result = cJSON_InvalidCharacterSequence_Error;
+                break;
+            }
+
+            // Point to the last character of the token
+            str += tokenLen - 1;
+
+            if (pFlags & CJP_DICT_VALUE_POSSIBLE)   pFlags = CJP_DICT_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
+            else                                    pFlags = CJP_LIST_END_POSSIBLE | CJP_ITEM_SEPT_POSSIBLE;
+            break;
+        }
+
+        // Handle next character
+        if (result == cJSON_Ok) str++;
+    }
+
+    if ((result != cJSON_Ok) && (errOffset != NULL)) *errOffset = (size_t)(str - ptr);
+
+    return result;
+}
+
+#pragma endregion
@@ -0,0 +1,405 @@
+/**
+ * @file cJSON_Writer.c
+ * @author HeCoding180
+ * @brief cJSON library writer source file.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../inc/cJSON_Scanner.h"
+#include "../inc/cJSON_Util.h"
+#include "../inc/cJSON_Writer.h"
+
+//   ---   Defines   ---
+
+// - Frame Flags -
+#pragma region Frame Flags
+
+/**
+ * @brief   Frame is a dictionary (list otherwise).
+ *
+ */
+#define WRITER_FRAME_DICT               0x01U
+/**
+ * @brief   At least one item has been written into the container, the next one needs a separator.
+ *
+ */
+#define WRITER_FRAME_HAS_ITEMS          0x02U
+/**
+ * @brief   A key has been written, the dictionary expects its value.
+ *
+ */
+#define WRITER_FRAME_KEY_WRITTEN        0x04U
+
+#pragma endregion
+
+//   ---   Static Function Implementations   ---
+
+// - Writer Helper Functions -
+#pragma region Writer Helper Functions
+
+/**
+ * @brief   Output callback of file descriptor writers.
+ *
+ */
+static bool cJSON_Writer_FdCallback(void *userData, const char *data, size_t len)
+{
+    int fd = (int)(intptr_t)userData;
+
+    while (len > 0)
+    {
+        ssize_t written = write(fd, data, len);
+        if (written <= 0) return false;
+
+        data += written;
+        len -= (size_t)written;
+    }
+
+    return true;
+}
+
+/**
+ * @brief   Passes the buffer to the output of flushing writers once it has reached CJSON_WRITER_FLUSH_SIZE.
+ *
+ */
+static cJSON_Result_t cJSON_Writer_MaybeFlush(cJSON_Writer_t *writer)
+{
+    if ((writer->callback != NULL) && (writer->buffer.bufferSize >= CJSON_WRITER_FLUSH_SIZE)) return cJSON_writerFlush(writer);
+
+    return writer->error;
+}
+
+/**
+ * @brief   Checks that a value is possible at the current location and writes its separator.
+ *
+ */
+static cJSON_Result_t cJSON_Writer_BeforeValue(cJSON_Writer_t *writer)
+{
+    if (writer->error != cJSON_Ok) return writer->error;
+
+    if (writer->depth == 0)
+    {
+        // A single root value
+        if (writer->rootWritten) writer->error = cJSON_Structure_Error;
+    }
+    else
+    {
+        uint8_t *frame = &writer->stack[writer->depth - 1];
+
+        if (*frame & WRITER_FRAME_DICT)
+        {
+            // Dictionary values follow their key, the separator was written with it
+            if (!(*frame & WRITER_FRAME_KEY_WRITTEN))   writer->error = cJSON_Structure_Error;
+            else                                        *frame &= (uint8_t)~WRITER_FRAME_KEY_WRITTEN;
+        }
+        else
+        {
+            if (*frame & WRITER_FRAME_HAS_ITEMS) SDB_AddChar(&writer->buffer, ',');
+            *frame |= WRITER_FRAME_HAS_ITEMS;
+        }
+    }
+
+    return writer->error;
+}
+
+/**
+ * @brief   Marks the root as complete if the value just written was the root value.
+ *
+ */
+static cJSON_Result_t cJSON_Writer_AfterValue(cJSON_Writer_t *writer)
+{
+    if (writer->depth == 0) writer->rootWritten = true;
+
+    return cJSON_Writer_MaybeFlush(writer);
+}
+
+/**
+ * @brief   Writes a quoted and escaped string.
+ *
+ */
+static void cJSON_Writer_AddString(cJSON_Writer_t *writer, const char *str, size_t length)
+{
+    const char *endPtr = str + length;
+
+    SDB_AddChar(&writer->buffer, '"');
+
+    while (str < endPtr)
+    {
+        // Copy plain characters as a whole run, escape the rest
+        const char *runEnd = SCAN_StringRun(str, endPtr);
+
+        SDB_AddChars(&writer->buffer, str, (size_t)(runEnd - str));
+        if (runEnd >= endPtr) break;
+
+        if ((*runEnd == '"') || (*runEnd == '\\'))
+        {
+            SDB_AddChar(&writer->buffer, '\\');
+            SDB_AddChar(&writer->buffer, *runEnd);
+        }
+        else
+        {
+            char escape[8];
+            snprintf(escape, sizeof(escape), "\\u%04x", (unsigned char)*runEnd);
+            SDB_AddChars(&writer->buffer, escape, 6);
+        }
+
+        str = runEnd + 1;
+    }
+
+    SDB_AddChar(&writer->buffer, '"');
+}
+
+/**
+ * @brief   Opens a container of the given frame type.
+ *
+ */
+static cJSON_Result_t cJSON_Writer_Begin(cJSON_Writer_t *writer, uint8_t frameFlags, char openChar)
+{
+    if (cJSON_Writer_BeforeValue(writer) != cJSON_Ok) return writer->error;
+
+    if (writer->depth >= CJSON_WRITER_MAX_DEPTH)
+    {
+        writer->error = cJSON_DepthOutOfRange_Error;
+        return writer->error;
+    }
+
+    writer->stack[writer->depth++] = frameFlags;
+    SDB_AddChar(&writer->buffer, openChar);
+
+    return cJSON_Ok;
+}
+
+/**
+ * @brief   Closes the innermost container if it is of the given frame type.
+ *
+ */
+static cJSON_Result_t cJSON_Writer_End(cJSON_Writer_t *writer, uint8_t frameFlags, char closeChar)
+{
+    if (writer->error != cJSON_Ok) return writer->error;
+
+    // Innermost container needs to match and mustn't have a key waiting for its value
+    if ((writer->depth == 0) || ((writer->stack[writer->depth - 1] & (WRITER_FRAME_DICT | WRITER_FRAME_KEY_WRITTEN)) != frameFlags))
+    {
+        writer->error = cJSON_Structure_Error;
+        return writer->error;
+    }
+
+    writer->depth--;
+    SDB_AddChar(&writer->buffer, closeChar);
+
+    return cJSON_Writer_AfterValue(writer);
+}
+
+#pragma endregion
+
+//   ---   Function Implementations   ---
+
+// - Writer Functions -
+#pragma region Writer Functions
+
+cJSON_Writer_t cJSON_createWriter(void)
+{
+    return cJSON_createCallbackWriter(NULL, NULL);
+}
+cJSON_Writer_t cJSON_createCallbackWriter(cJSON_WriteCallback_t callback, void *userData)
+{
+    cJSON_Writer_t tempWriter = {0};
+
+    // Buffer grows on demand
+    tempWriter.callback = callback;
+    tempWriter.userData = userData;
+    tempWriter.error = cJSON_Ok;
+
+    return tempWriter;
+}
+cJSON_Writer_t cJSON_createFdWriter(int fd)
+{
+    return cJSON_createCallbackWriter(cJSON_Writer_FdCallback, (void*)(intptr_t)fd);
+}
+void cJSON_deleteWriter(cJSON_Writer_t *writer)
+{
+    SDB_Free(&writer->buffer);
+}
+
+cJSON_Result_t cJSON_writerBeginDict(cJSON_Writer_t *writer)
+{
+    return cJSON_Writer_Begin(writer, WRITER_FRAME_DICT, '{');
+}
+cJSON_Result_t cJSON_writerEndDict(cJSON_Writer_t *writer)
+{
+    return cJSON_Writer_End(writer, WRITER_FRAME_DICT, '}');
+}
+cJSON_Result_t cJSON_writerBeginList(cJSON_Writer_t *writer)
+{
+    return cJSON_Writer_Begin(writer, 0, '[');
+}
+cJSON_Result_t cJSON_writerEndList(cJSON_Writer_t *writer)
+{
+    return cJSON_Writer_End(writer, 0, ']');
+}
+cJSON_Result_t cJSON_writerKey(cJSON_Writer_t *writer, const char *key)
+{
+    return cJSON_writerKeyView(writer, key, strlen(key));
+}
+cJSON_Result_t cJSON_writerKeyView(cJSON_Writer_t *writer, const char *key, size_t length)
+{
+    if (writer->error != cJSON_Ok) return writer->error;
+
+    if ((writer->depth == 0) || ((writer->stack[writer->depth - 1] & (WRITER_FRAME_DICT | WRITER_FRAME_KEY_WRITTEN)) != WRITER_FRAME_DICT))
+    {
+        writer->error = cJSON_Structure_Error;
+        return writer->error;
+    }
+
+    uint8_t *frame = &writer->stack[writer->depth - 1];
+
+    if (*frame & WRITER_FRAME_HAS_ITEMS) SDB_AddChar(&writer->buffer, ',');
+    *frame |= WRITER_FRAME_HAS_ITEMS | WRITER_FRAME_KEY_WRITTEN;
+
+    cJSON_Writer_AddString(writer, key, length);
+    SDB_AddChar(&writer->buffer, ':');
+
+    return cJSON_Ok;
+}
+
+cJSON_Result_t cJSON_writerString(cJSON_Writer_t *writer, const char *str)
+{
+    if (str == NULL) return cJSON_writerNull(writer);
+
+    if (cJSON_Writer_BeforeValue(writer) != cJSON_Ok) return writer->error;
+
+    cJSON_Writer_AddString(writer, str, strlen(str));
+
+    return cJSON_Writer_AfterValue(writer);
+}
+cJSON_Result_t cJSON_writerStringView(cJSON_Writer_t *writer, const char *str, size_t length)
+{
+    if (cJSON_Writer_BeforeValue(writer) != cJSON_Ok) return writer->error;
+
+    cJSON_Writer_AddString(writer, str, length);
+
+    return cJSON_Writer_AfterValue(writer);
+}
+cJSON_Result_t cJSON_writerInt(cJSON_Writer_t *writer, cJSON_Int_t intVal)
+{
+    char numBuffer[CJSON_MAX_NUM_LEN + 1];
+
+    if (cJSON_Writer_BeforeValue(writer) != cJSON_Ok) return writer->error;
+
+    int numStrLen = snprintf(numBuffer, sizeof(numBuffer), "%" PRId32, (int32_t)intVal);
+    SDB_AddChars(&writer->buffer, numBuffer, (size_t)numStrLen);
+
+    return cJSON_Writer_AfterValue(writer);
+}
+cJSON_Result_t cJSON_writerFloat(cJSON_Writer_t *writer, cJSON_Float_t floatVal)
+{
+    char numBuffer[CJSON_MAX_NUM_LEN + 1];
+    int numStrLen;
+
+    if (cJSON_Writer_BeforeValue(writer) != cJSON_Ok) return writer->error;
+
+    // JSON has no representation for inf and nan
+    if ((floatVal != floatVal) || ((floatVal - floatVal) != 0))     numStrLen = snprintf(numBuffer, sizeof(numBuffer), "null");
+    else                                                            numStrLen = snprintf(numBuffer, sizeof(numBuffer), "%.9g", (double)floatVal);
+
+    SDB_AddChars(&writer->buffer, numBuffer, (size_t)numStrLen);
+
+    // Integral values are written without fraction and exponent, keep them floats
+    if (strpbrk(numBuffer, ".eni") == NULL) SDB_AddChars(&writer->buffer, ".0", 2);
+
+    return cJSON_Writer_AfterValue(writer);
+}
+cJSON_Result_t cJSON_writerBool(cJSON_Writer_t *writer, cJSON_Bool_t boolVal)
+{
+    if (cJSON_Writer_BeforeValue(writer) != cJSON_Ok) return writer->error;
+
+    SDB_AddChars(&writer->buffer, boolVal ? "true" : "false", boolVal ? 4 : 5);
+
+    return cJSON_Writer_AfterValue(writer);
+}
+cJSON_Result_t cJSON_writerNull(cJSON_Writer_t *writer)
+{
+    if (cJSON_Writer_BeforeValue(writer) != cJSON_Ok) return writer->error;
+
+    SDB_AddChars(&writer->buffer, "null", 4);
+
+    return cJSON_Writer_AfterValue(writer);
+}
+cJSON_Result_t cJSON_writerValue(cJSON_Writer_t *writer, cJSON_Generic_t GObj)
+{
+    if (GObj.dataContainer == NULL) return cJSON_writerNull(writer);
+
+    switch (GObj.type)
+    {
+    case Dictionary:
+        cJSON_writerBeginDict(writer);
+        for (cJSON_object_size_size_t i = 0; i < AS_DICT_PTR(GObj)->length; i++)
+        {
+            cJSON_writerKeyView(writer, AS_DICT_PTR(GObj)->keyData[i], cJSON_getDictKeyLength(AS_DICT_PTR(GObj), i));
+            if (cJSON_writerValue(writer, AS_DICT_PTR(GObj)->valueData[i]) != cJSON_Ok) break;
+        }
+        return cJSON_writerEndDict(writer);
+    case List:
+        cJSON_writerBeginList(writer);
+        for (cJSON_object_size_size_t i = 0; i < AS_LIST_PTR(GObj)->length; i++)
+        {
+            if (cJSON_writerValue(writer, AS_LIST_PTR(GObj)->data[i]) != cJSON_Ok) break;
+        }
+        return cJSON_writerEndList(writer);
+    case IntArray:
+        cJSON_writerBeginList(writer);
+        for (cJSON_object_size_size_t i = 0; i < AS_INT_ARRAY_PTR(GObj)->length; i++)
+        {
+            if (cJSON_writerInt(writer, AS_INT_ARRAY_PTR(GObj)->data[i]) != cJSON_Ok) break;
+        }
+        return cJSON_writerEndList(writer);
+    case FloatArray:
+        cJSON_writerBeginList(writer);
+        for (cJSON_object_size_size_t i = 0; i < AS_FLOAT_ARRAY_PTR(GObj)->length; i++)
+        {
+            if (cJSON_writerFloat(writer, AS_FLOAT_ARRAY_PTR(GObj)->data[i]) != cJSON_Ok) break;
+        }
+        return cJSON_writerEndList(writer);
+    case String:
+        return cJSON_writerStringView(writer, AS_STRING(GObj), AS_STRING_LENGTH(GObj));
+    case Integer:
+        return cJSON_writerInt(writer, AS_INT(GObj));
+    case Float:
+        return cJSON_writerFloat(writer, AS_FLOAT(GObj));
+    case Boolean:
+        return cJSON_writerBool(writer, AS_BOOL(GObj));
+    default:
+        return cJSON_writerNull(writer);
+    }
+}
+
+cJSON_Result_t cJSON_writerFlush(cJSON_Writer_t *writer)
+{
+    if ((writer->error != cJSON_Ok) || (writer->callback == NULL) || (writer->buffer.bufferSize == 0)) return writer->error;
+
+    if (!writer->callback(writer->userData, writer->buffer.buffer, writer->buffer.bufferSize))  writer->error = cJSON_Unknown_Error;
+    else                                                                                        SDB_Reset(&writer->buffer);
+
+    return writer->error;
+}
+cJSON_Result_t cJSON_writerFinish(cJSON_Writer_t *writer)
+{
+    if ((writer->error == cJSON_Ok) && ((writer->depth != 0) || !writer->rootWritten)) writer->error = cJSON_Structure_Error;
+
+    return cJSON_writerFlush(writer);
+}
+const char* cJSON_writerGetStr(cJSON_Writer_t *writer, size_t *len)
+{
+    if (len != NULL) *len = writer->buffer.bufferSize;
+
+    return SDB_GetStr(&writer->buffer);
+}
+
+#pragma endregion
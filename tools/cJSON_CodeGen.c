@@ -0,0 +1,1155 @@
+/**
+ * @file cJSON_CodeGen.c
+ * @author HeCoding180
+ * @brief cJSON code generator. Generates a dedicated parser, serializer and struct types for a fixed message schema, taken either from an example document or from a JSON Schema subset.
+ *        The generated code dispatches keys on their length and contents, writes values straight into fixed struct members and reuses the library's string, number and skip primitives (cJSON_Parser_Util.h). No cJSON_Generic_t objects are built.
+ *
+ *        Usage:    cJSON_CodeGen [--schema] <input.json> <TypeName> <outBase>
+ *                  Writes <outBase>.h and <outBase>.c, the library's inc directory needs to be on the include path of the generated source.
+ *
+ *        Mapping:  Dictionaries become structs, strings become heap allocated char* members, integers cJSON_Int_t, numbers cJSON_Float_t and booleans cJSON_Bool_t.
+ *                  Integers outside the cJSON_Int_t range are rejected by the generated parser (cJSON_LimitExceeded_Error), example values outside the range are reported as a warning.
+ *                  Lists of one of these become {data, length, capacity} members (integers mixed with floats become floats, lists of dictionaries use the first dictionary's layout).
+ *                  Null values, empty lists, mixed lists and nested lists have no fixed type, their keys are skipped when parsing and not serialized.
+ *
+ *        Schema:   "type": "object" with "properties", "array" with "items", "string", "integer", "number" and "boolean" are supported.
+ * @version 0.1.0
+ * @date 2026-10-19
+ *
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../inc/cJSON.h"
+#include "../inc/cJSON_Parser_Util.h"
+#include "../inc/cJSON_Util.h"
+
+//   ---   Typedefs   ---
+
+// - Schema Model Typedefs -
+#pragma region Schema Model Typedefs
+
+typedef enum CG_Kind
+{
+    CG_Skip,
+    CG_Int,
+    CG_Float,
+    CG_Bool,
+    CG_String,
+    CG_Object
+} CG_Kind_t;
+
+struct CG_Type;
+
+typedef struct CG_Field
+{
+    char *key;
+    size_t keyLen;
+    char *member;
+    CG_Kind_t kind;
+    bool isList;
+    struct CG_Type *objType;
+} CG_Field_t;
+
+typedef struct CG_Type
+{
+    char *name;
+    CG_Field_t *fields;
+    size_t fieldCount;
+    struct CG_Type *next;
+} CG_Type_t;
+
+#pragma endregion
+
+//   ---   Variables   ---
+
+/**
+ * @brief   Types in post order (nested types before the types using them), so they can be emitted without forward declarations.
+ *
+ */
+static CG_Type_t *typeListHead = NULL;
+static CG_Type_t **typeListTail = &typeListHead;
+
+/**
+ * @brief   Prefix of all generated helper functions (name of the root type).
+ *
+ */
+static const char *rootName = NULL;
+
+//   ---   Static Function Implementations   ---
+
+// - Model Helper Functions -
+#pragma region Model Helper Functions
+
+static char* CG_MemDup(const char *bytes, size_t len)
+{
+    char *copy = (char*)malloc(len + 1);
+
+    memcpy(copy, bytes, len);
+    copy[len] = '\0';
+    return copy;
+}
+static char* CG_StrDup(const char *str)
+{
+    return CG_MemDup(str, strlen(str));
+}
+static char* CG_Concat(const char *a, const char *b, const char *c)
+{
+    char *str = (char*)malloc(strlen(a) + strlen(b) + strlen(c) + 1);
+
+    sprintf(str, "%s%s%s", a, b, c);
+    return str;
+}
+
+/**
+ * @brief   Turns a key of keyLen bytes into a valid C identifier (invalid characters become '_', C keywords get a '_' suffix).
+ *          Keys not starting with a letter get a 'k' prefix, so identifiers never start with '_' (reserved names like __2 or _Key).
+ *
+ */
+static char* CG_Identifier(const char *key, size_t keyLen)
+{
+    static const char *keywords[] =
+    {
+        "auto", "bool", "break", "case", "char", "const", "continue", "default", "do", "double", "else", "enum", "extern", "false", "float", "for", "goto", "if",
+        "inline", "int", "long", "register", "restrict", "return", "short", "signed", "sizeof", "static", "struct", "switch", "true", "typedef", "union",
+        "unsigned", "void", "volatile", "while"
+    };
+
+    char *ident = (char*)malloc(keyLen + 3);
+    size_t j = 0;
+
+    if ((keyLen == 0) || !isalpha((unsigned char)key[0])) ident[j++] = 'k';
+
+    for (size_t i = 0; i < keyLen; i++) ident[j++] = (isalnum((unsigned char)key[i]) || (key[i] == '_')) ? key[i] : '_';
+
+    ident[j] = '\0';
+
+    for (size_t i = 0; i < (sizeof(keywords) / sizeof(keywords[0])); i++)
+    {
+        if (!strcmp(ident, keywords[i]))
+        {
+            ident[j++] = '_';
+            ident[j] = '\0';
+            break;
+        }
+    }
+
+    return ident;
+}
+
+static void CG_AddField(CG_Type_t *type, CG_Field_t field)
+{
+    // Member names need to be unique after sanitizing
+    for (size_t suffix = 2; ; suffix++)
+    {
+        bool isUnique = true;
+
+        for (size_t i = 0; i < type->fieldCount; i++)
+        {
+            if (!strcmp(type->fields[i].member, field.member)) isUnique = false;
+        }
+
+        if (isUnique) break;
+
+        char suffixStr[24];
+        snprintf(suffixStr, sizeof(suffixStr), "_%zu", suffix);
+
+        char *member = CG_Concat(field.member, suffixStr, "");
+        free(field.member);
+        field.member = member;
+    }
+
+    type->fields = (CG_Field_t*)realloc(type->fields, (type->fieldCount + 1) * sizeof(CG_Field_t));
+    type->fields[type->fieldCount++] = field;
+}
+static CG_Type_t* CG_NewType(const char *name)
+{
+    CG_Type_t *type = (CG_Type_t*)calloc(1, sizeof(CG_Type_t));
+
+    type->name = CG_StrDup(name);
+    return type;
+}
+static void CG_RegisterType(CG_Type_t *type)
+{
+    *typeListTail = type;
+    typeListTail = &type->next;
+}
+
+static CG_Kind_t CG_KindFromExample(cJSON_Generic_t value)
+{
+    switch (value.type)
+    {
+    case Integer:       return CG_Int;
+    case Float:         return CG_Float;
+    case Boolean:       return CG_Bool;
+    case String:        return CG_String;
+    case Dictionary:    return CG_Object;
+    default:            return CG_Skip;
+    }
+}
+
+static CG_Type_t* CG_TypeFromExample(const cJSON_Dict_t *dict, const char *typeName)
+{
+    CG_Type_t *type = CG_NewType(typeName);
+
+    for (cJSON_object_size_size_t i = 0; i < dict->length; i++)
+    {
+        CG_Field_t field = {0};
+        cJSON_Generic_t value = dict->valueData[i];
+        cJSON_Generic_t layoutObj = value;
+
+        field.keyLen = cJSON_getDictKeyLength(dict, i);
+        field.key = CG_MemDup(dict->keyData[i], field.keyLen);
+        field.member = CG_Identifier(dict->keyData[i], field.keyLen);
+
+        if (value.type == List)
+        {
+            cJSON_List_t *list = AS_LIST_PTR(value);
+
+            field.isList = true;
+            field.kind = (list->length > 0) ? CG_KindFromExample(list->data[0]) : CG_Skip;
+            if (list->length > 0) layoutObj = list->data[0];
+
+            // All items need to share one type, integers are promoted to floats
+            for (cJSON_object_size_size_t j = 1; (j < list->length) && (field.kind != CG_Skip); j++)
+            {
+                CG_Kind_t itemKind = CG_KindFromExample(list->data[j]);
+
+                if ((field.kind == CG_Int) && (itemKind == CG_Float))           field.kind = CG_Float;
+                else if ((field.kind == CG_Float) && (itemKind == CG_Int))      continue;
+                else if (itemKind != field.kind)                                field.kind = CG_Skip;
+            }
+        }
+        else
+        {
+            field.kind = CG_KindFromExample(value);
+        }
+
+        if (field.kind == CG_Object)
+        {
+            char *childName = CG_Concat(typeName, "_", field.member);
+            char *itemName = field.isList ? CG_Concat(childName, "_item", "") : CG_StrDup(childName);
+
+            field.objType = CG_TypeFromExample(AS_DICT_PTR(layoutObj), itemName);
+
+            free(childName);
+            free(itemName);
+        }
+
+        CG_AddField(type, field);
+    }
+
+    CG_RegisterType(type);
+    return type;
+}
+
+static const char* CG_SchemaString(const cJSON_Dict_t *schema, const char *key)
+{
+    cJSON_object_size_size_t index;
+
+    if (!cJSON_findDictKey(schema, key, 0, &index) || (schema->valueData[index].type != String)) return NULL;
+    return AS_STRING(schema->valueData[index]);
+}
+static const cJSON_Dict_t* CG_SchemaDict(const cJSON_Dict_t *schema, const char *key)
+{
+    cJSON_object_size_size_t index;
+
+    if (!cJSON_findDictKey(schema, key, 0, &index) || (schema->valueData[index].type != Dictionary)) return NULL;
+    return AS_DICT_PTR(schema->valueData[index]);
+}
+static CG_Kind_t CG_KindFromSchema(const cJSON_Dict_t *schema)
+{
+    const char *typeStr = CG_SchemaString(schema, "type");
+
+    if (typeStr == NULL)                        return CG_Skip;
+    else if (!strcmp(typeStr, "integer"))       return CG_Int;
+    else if (!strcmp(typeStr, "number"))        return CG_Float;
+    else if (!strcmp(typeStr, "boolean"))       return CG_Bool;
+    else if (!strcmp(typeStr, "string"))        return CG_String;
+    else if (!strcmp(typeStr, "object"))        return CG_Object;
+    else                                        return CG_Skip;
+}
+
+static CG_Type_t* CG_TypeFromSchema(const cJSON_Dict_t *schema, const char *typeName)
+{
+    CG_Type_t *type = CG_NewType(typeName);
+    const cJSON_Dict_t *properties = CG_SchemaDict(schema, "properties");
+
+    for (cJSON_object_size_size_t i = 0; (properties != NULL) && (i < properties->length); i++)
+    {
+        CG_Field_t field = {0};
+        const cJSON_Dict_t *layoutSchema = NULL;
+
+        field.keyLen = cJSON_getDictKeyLength(properties, i);
+        field.key = CG_MemDup(properties->keyData[i], field.keyLen);
+        field.member = CG_Identifier(properties->keyData[i], field.keyLen);
+
+        if (properties->valueData[i].type == Dictionary)
+        {
+            const cJSON_Dict_t *propSchema = AS_DICT_PTR(properties->valueData[i]);
+            const char *typeStr = CG_SchemaString(propSchema, "type");
+
+            layoutSchema = propSchema;
+
+            if ((typeStr != NULL) && !strcmp(typeStr, "array"))
+            {
+                field.isList = true;
+                layoutSchema = CG_SchemaDict(propSchema, "items");
+            }
+
+            field.kind = (layoutSchema != NULL) ? CG_KindFromSchema(layoutSchema) : CG_Skip;
+        }
+
+        if (field.kind == CG_Object)
+        {
+            char *childName = CG_Concat(typeName, "_", field.member);
+            char *itemName = field.isList ? CG_Concat(childName, "_item", "") : CG_StrDup(childName);
+
+            field.objType = CG_TypeFromSchema(layoutSchema, itemName);
+
+            free(childName);
+            free(itemName);
+        }
+
+        CG_AddField(type, field);
+    }
+
+    CG_RegisterType(type);
+    return type;
+}
+
+/**
+ * @brief   Warns about integers of the example document outside the cJSON_Int_t range. The library truncates them when parsing, so the raw document is scanned.
+ *
+ */
+static void CG_CheckIntRange(const char *str, const char *endPtr)
+{
+    cJSON_SDB_t lastString = {0};
+
+    while (str < endPtr)
+    {
+        if (*str == '"')
+        {
+            // The last string before a value is its key
+            if (cJSON_Parser_StringBuilder(&str, endPtr, &lastString) != cJSON_Ok) break;
+            str++;
+        }
+        else if ((*str == '-') || ((*str >= '0') && (*str <= '9')))
+        {
+            bool numIsFloat = false;
+            size_t numStrLen = cJSON_Parser_ScanNumber(str, endPtr, &numIsFloat);
+
+            if (numStrLen == 0) break;
+
+            if (!numIsFloat)
+            {
+                char *numStr = CG_MemDup(str, numStrLen);
+                long long intVal;
+
+                errno = 0;
+                intVal = strtoll(numStr, NULL, 10);
+                if ((errno == ERANGE) || (intVal != (cJSON_Int_t)intVal))
+                {
+                    fprintf(stderr, "Warning: %s (key \"%s\") is outside the cJSON_Int_t range, the generated parser rejects it with cJSON_LimitExceeded_Error\n",
+                            numStr, (lastString.bufferSize > 0) ? SDB_GetStr(&lastString) : "");
+                }
+
+                free(numStr);
+            }
+
+            str += numStrLen;
+        }
+        else
+        {
+            str++;
+        }
+    }
+
+    SDB_Free(&lastString);
+}
+
+static bool CG_UsesKind(CG_Kind_t kind)
+{
+    for (CG_Type_t *type = typeListHead; type != NULL; type = type->next)
+    {
+        for (size_t i = 0; i < type->fieldCount; i++)
+        {
+            if (type->fields[i].kind == kind) return true;
+        }
+    }
+
+    return false;
+}
+
+#pragma endregion
+
+// - Emitter Helper Functions -
+#pragma region Emitter Helper Functions
+
+/**
+ * @brief   Writes bytes as a C string literal. Bytes that aren't printable ASCII are written as octal escapes.
+ *
+ */
+static void CG_WriteCString(FILE *fPtr, const char *bytes, size_t len)
+{
+    fputc('"', fPtr);
+
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned char c = (unsigned char)bytes[i];
+
+        if ((c == '"') || (c == '\\'))      fprintf(fPtr, "\\%c", c);
+        else if ((c < 0x20) || (c > 0x7E))  fprintf(fPtr, "\\%03o", c);
+        else                                fputc(c, fPtr);
+    }
+
+    fputc('"', fPtr);
+}
+/**
+ * @brief   Writes the serialized form of a key of keyLen bytes ("key":, with a leading ',' if requested) as arguments of an SDB_AddChars call.
+ *
+ */
+static void CG_WriteKeyLiteral(FILE *fPtr, const char *key, size_t keyLen, bool leadingComma)
+{
+    cJSON_SDB_t jsonKey = {0};
+
+    if (leadingComma) SDB_AddChar(&jsonKey, ',');
+    SDB_AddChar(&jsonKey, '"');
+
+    for (const char *c = key; c < (key + keyLen); c++)
+    {
+        if ((*c == '"') || (*c == '\\'))
+        {
+            SDB_AddChar(&jsonKey, '\\');
+            SDB_AddChar(&jsonKey, *c);
+        }
+        else if ((unsigned char)*c < 0x20)
+        {
+            char escape[8];
+            snprintf(escape, sizeof(escape), "\\u%04x", (unsigned char)*c);
+            SDB_AddChars(&jsonKey, escape, 6);
+        }
+        else
+        {
+            SDB_AddChar(&jsonKey, *c);
+        }
+    }
+
+    SDB_AddChars(&jsonKey, "\":", 2);
+
+    CG_WriteCString(fPtr, SDB_GetStr(&jsonKey), jsonKey.bufferSize);
+    fprintf(fPtr, ", %zu", jsonKey.bufferSize);
+
+    SDB_Free(&jsonKey);
+}
+
+static const char* CG_CType(const CG_Field_t *field)
+{
+    static char typeBuffer[512];
+
+    switch (field->kind)
+    {
+    case CG_Int:        return "cJSON_Int_t";
+    case CG_Float:      return "cJSON_Float_t";
+    case CG_Bool:       return "cJSON_Bool_t";
+    case CG_String:     return "char";
+    case CG_Object:
+        snprintf(typeBuffer, sizeof(typeBuffer), "%s_t", field->objType->name);
+        return typeBuffer;
+    default:            return NULL;
+    }
+}
+
+/**
+ * @brief   Writes the declaration of a variable of the field's kind (strings are char pointers).
+ *
+ */
+static void CG_WriteDecl(FILE *fPtr, const CG_Field_t *field, const char *declName)
+{
+    fprintf(fPtr, "%s %s%s", CG_CType(field), (field->kind == CG_String) ? "*" : "", declName);
+}
+
+/**
+ * @brief   Writes the call parsing a single value of the field's kind into target (an lvalue expression).
+ *
+ */
+static void CG_WriteParseCall(FILE *fPtr, const CG_Field_t *field, const char *target, const char *depthExpr)
+{
+    switch (field->kind)
+    {
+    case CG_Int:        fprintf(fPtr, "%s_ParseInt(state, &%s)", rootName, target); break;
+    case CG_Float:      fprintf(fPtr, "%s_ParseFloat(state, &%s)", rootName, target); break;
+    case CG_Bool:       fprintf(fPtr, "%s_ParseBool(state, &%s)", rootName, target); break;
+    case CG_String:     fprintf(fPtr, "%s_ParseString(state, &%s)", rootName, target); break;
+    case CG_Object:     fprintf(fPtr, "%s_parseObject(state, &%s, %s)", field->objType->name, target, depthExpr); break;
+    default:            break;
+    }
+}
+/**
+ * @brief   Writes the call serializing a single value of the field's kind from source (an rvalue expression).
+ *
+ */
+static void CG_WriteSerializeCall(FILE *fPtr, const CG_Field_t *field, const char *source)
+{
+    switch (field->kind)
+    {
+    case CG_Int:        fprintf(fPtr, "%s_WriteInt(out, %s)", rootName, source); break;
+    case CG_Float:      fprintf(fPtr, "%s_WriteFloat(out, %s)", rootName, source); break;
+    case CG_Bool:       fprintf(fPtr, "SDB_AddChars(out, (%s) ? \"true\" : \"false\", (%s) ? 4 : 5)", source, source); break;
+    case CG_String:     fprintf(fPtr, "%s_WriteString(out, %s)", rootName, source); break;
+    case CG_Object:     fprintf(fPtr, "%s_serializeObject(&%s, out)", field->objType->name, source); break;
+    default:            break;
+    }
+}
+
+#pragma endregion
+
+// - Header Emitter Functions -
+#pragma region Header Emitter Functions
+
+static void CG_EmitHeader(FILE *fPtr, const char *fileName, const char *guardName)
+{
+    fprintf(fPtr, "/**\n * @file %s\n * @brief Generated by cJSON_CodeGen, do not edit. Dedicated parser and serializer for %s_t.\n *\n */\n\n", fileName, rootName);
+    fprintf(fPtr, "#ifndef %s\n#define %s\n\n", guardName, guardName);
+    fprintf(fPtr, "#include \"cJSON_StringDoubleBuffer.h\"\n#include \"cJSON_Types.h\"\n\n");
+
+    fprintf(fPtr, "//   ---   Typedefs   ---\n\n");
+
+    for (CG_Type_t *type = typeListHead; type != NULL; type = type->next)
+    {
+        // List member types
+        for (size_t i = 0; i < type->fieldCount; i++)
+        {
+            const CG_Field_t *field = &type->fields[i];
+            if (!field->isList || (field->kind == CG_Skip)) continue;
+
+            fprintf(fPtr, "typedef struct %s_%s_list\n{\n", type->name, field->member);
+            fprintf(fPtr, "    ");
+            CG_WriteDecl(fPtr, field, "*data");
+            fprintf(fPtr, ";\n");
+            fprintf(fPtr, "    cJSON_object_size_size_t length;\n    cJSON_object_size_size_t capacity;\n");
+            fprintf(fPtr, "} %s_%s_list_t;\n\n", type->name, field->member);
+        }
+
+        fprintf(fPtr, "typedef struct %s\n{\n", type->name);
+
+        bool hasMembers = false;
+        for (size_t i = 0; i < type->fieldCount; i++)
+        {
+            const CG_Field_t *field = &type->fields[i];
+
+            if (field->kind == CG_Skip)
+            {
+                fprintf(fPtr, "    // \"%s\": no fixed type, skipped\n", field->member);
+                continue;
+            }
+
+            fprintf(fPtr, "    ");
+            if (field->isList)  fprintf(fPtr, "%s_%s_list_t %s", type->name, field->member, field->member);
+            else                CG_WriteDecl(fPtr, field, field->member);
+            fprintf(fPtr, ";\n");
+
+            hasMembers = true;
+        }
+
+        // Empty structs aren't valid C
+        if (!hasMembers) fprintf(fPtr, "    char unused;\n");
+
+        fprintf(fPtr, "} %s_t;\n\n", type->name);
+    }
+
+    fprintf(fPtr, "//   ---   Function Prototypes   ---\n\n");
+    fprintf(fPtr, "/**\n * @brief   Parses a JSON dictionary into obj. obj needs to be zero initialized, null values and missing keys leave members untouched. Integers outside the cJSON_Int_t range return cJSON_LimitExceeded_Error.\n *\n */\n");
+    fprintf(fPtr, "cJSON_Result_t %s_parse(%s_t *obj, const char *ptr, size_t len);\n", rootName, rootName);
+    fprintf(fPtr, "/**\n * @brief   Serializes obj as compact JSON, appending it to out.\n *\n */\n");
+    fprintf(fPtr, "void %s_serialize(const %s_t *obj, cJSON_SDB_t *out);\n", rootName, rootName);
+    fprintf(fPtr, "/**\n * @brief   Frees the heap allocated strings and lists of obj.\n *\n */\n");
+    fprintf(fPtr, "void %s_free(%s_t *obj);\n\n", rootName, rootName);
+
+    fprintf(fPtr, "#endif // %s\n", guardName);
+}
+
+#pragma endregion
+
+// - Source Emitter Functions -
+#pragma region Source Emitter Functions
+
+static void CG_EmitHelpers(FILE *fPtr)
+{
+    fprintf(fPtr, "//   ---   Typedefs   ---\n\n");
+    fprintf(fPtr, "typedef struct %s_State\n{\n    const char *str;\n    const char *endPtr;\n    cJSON_SDB_t strBuffer;\n} %s_State_t;\n\n", rootName, rootName);
+
+    fprintf(fPtr, "//   ---   Static Function Implementations   ---\n\n");
+
+    if (CG_UsesKind(CG_Int) || CG_UsesKind(CG_Float))
+    {
+        fprintf(fPtr,
+            "static cJSON_Result_t %s_ScanNumber(%s_State_t *state, char *numBuffer, bool *numIsFloat)\n"
+            "{\n"
+            "    size_t numStrLen = cJSON_Parser_ScanNumber(state->str, state->endPtr, numIsFloat);\n"
+            "\n"
+            "    if ((state->str < state->endPtr) && (*state->str != '-') && ((*state->str < '0') || (*state->str > '9'))) return cJSON_Datatype_Error;\n"
+            "    if ((numStrLen == 0) || (numStrLen > CJSON_MAX_NUM_LEN)) return cJSON_InvalidCharacterSequence_Error;\n"
+            "\n"
+            "    memcpy(numBuffer, state->str, numStrLen);\n"
+            "    numBuffer[numStrLen] = '\\0';\n"
+            "    state->str += numStrLen;\n"
+            "\n"
+            "    return cJSON_Ok;\n"
+            "}\n", rootName, rootName);
+    }
+    if (CG_UsesKind(CG_Int))
+    {
+        fprintf(fPtr,
+            "static cJSON_Result_t %s_ParseInt(%s_State_t *state, cJSON_Int_t *val)\n"
+            "{\n"
+            "    char numBuffer[CJSON_MAX_NUM_LEN + 1];\n"
+            "    bool numIsFloat = false;\n"
+            "    long long intVal;\n"
+            "    cJSON_Result_t result = %s_ScanNumber(state, numBuffer, &numIsFloat);\n"
+            "\n"
+            "    if (result != cJSON_Ok) return result;\n"
+            "    if (numIsFloat) return cJSON_Datatype_Error;\n"
+            "\n"
+            "    // Integers outside the cJSON_Int_t range are rejected instead of truncated\n"
+            "    errno = 0;\n"
+            "    intVal = strtoll(numBuffer, NULL, 10);\n"
+            "    if ((errno == ERANGE) || (intVal != (cJSON_Int_t)intVal)) return cJSON_LimitExceeded_Error;\n"
+            "\n"
+            "    *val = (cJSON_Int_t)intVal;\n"
+            "    return cJSON_Ok;\n"
+            "}\n"
+            "static void %s_WriteInt(cJSON_SDB_t *out, cJSON_Int_t val)\n"
+            "{\n"
+            "    char numBuffer[CJSON_MAX_NUM_LEN + 1];\n"
+            "    int numStrLen = snprintf(numBuffer, sizeof(numBuffer), \"%%\" PRId32, (int32_t)val);\n"
+            "\n"
+            "    SDB_AddChars(out, numBuffer, (size_t)numStrLen);\n"
+            "}\n", rootName, rootName, rootName, rootName);
+    }
+    if (CG_UsesKind(CG_Float))
+    {
+        fprintf(fPtr,
+            "static cJSON_Result_t %s_ParseFloat(%s_State_t *state, cJSON_Float_t *val)\n"
+            "{\n"
+            "    char numBuffer[CJSON_MAX_NUM_LEN + 1];\n"
+            "    bool numIsFloat = false;\n"
+            "    cJSON_Result_t result = %s_ScanNumber(state, numBuffer, &numIsFloat);\n"
+            "\n"
+            "    if (result != cJSON_Ok) return result;\n"
+            "\n"
+            "    *val = (cJSON_Float_t)strtod(numBuffer, NULL);\n"
+            "    return cJSON_Ok;\n"
+            "}\n"
+            "static void %s_WriteFloat(cJSON_SDB_t *out, cJSON_Float_t val)\n"
+            "{\n"
+            "    char numBuffer[CJSON_MAX_NUM_LEN + 1];\n"
+            "    int numStrLen;\n"
+            "\n"
+            "    // JSON has no representation for inf and nan\n"
+            "    if (val != val || (val - val) != 0)     numStrLen = snprintf(numBuffer, sizeof(numBuffer), \"null\");\n"
+            "    else                                    numStrLen = snprintf(numBuffer, sizeof(numBuffer), \"%%.9g\", (double)val);\n"
+            "\n"
+            "    SDB_AddChars(out, numBuffer, (size_t)numStrLen);\n"
+            "\n"
+            "    // Integral values are written without fraction and exponent, keep them floats\n"
+            "    if (strpbrk(numBuffer, \".eni\") == NULL) SDB_AddChars(out, \".0\", 2);\n"
+            "}\n", rootName, rootName, rootName, rootName);
+    }
+    if (CG_UsesKind(CG_Bool))
+    {
+        fprintf(fPtr,
+            "static cJSON_Result_t %s_ParseBool(%s_State_t *state, cJSON_Bool_t *val)\n"
+            "{\n"
+            "    if (cJSON_Parser_MatchLiteral(state->str, state->endPtr, \"true\", 4))\n"
+            "    {\n"
+            "        *val = true;\n"
+            "        state->str += 4;\n"
+            "        return cJSON_Ok;\n"
+            "    }\n"
+            "    if (cJSON_Parser_MatchLiteral(state->str, state->endPtr, \"false\", 5))\n"
+            "    {\n"
+            "        *val = false;\n"
+            "        state->str += 5;\n"
+            "        return cJSON_Ok;\n"
+            "    }\n"
+            "\n"
+            "    return cJSON_Datatype_Error;\n"
+            "}\n", rootName, rootName);
+    }
+    if (CG_UsesKind(CG_String))
+    {
+        fprintf(fPtr,
+            "static cJSON_Result_t %s_ParseString(%s_State_t *state, char **val)\n"
+            "{\n"
+            "    cJSON_Result_t result;\n"
+            "\n"
+            "    if ((state->str >= state->endPtr) || (*state->str != '\"')) return cJSON_Datatype_Error;\n"
+            "\n"
+            "    result = cJSON_Parser_StringBuilder(&state->str, state->endPtr, &state->strBuffer);\n"
+            "    if (result != cJSON_Ok) return result;\n"
+            "\n"
+            "    // Replace string of a duplicate key\n"
+            "    free(*val);\n"
+            "    *val = (char*)malloc(state->strBuffer.bufferSize + 1);\n"
+            "    if (*val == NULL) return cJSON_NotAllocated_Error;\n"
+            "\n"
+            "    memcpy(*val, SDB_GetStr(&state->strBuffer), state->strBuffer.bufferSize + 1);\n"
+            "\n"
+            "    state->str++;\n"
+            "    return cJSON_Ok;\n"
+            "}\n"
+            "static void %s_WriteString(cJSON_SDB_t *out, const char *val)\n"
+            "{\n"
+            "    const char *endPtr;\n"
+            "\n"
+            "    if (val == NULL)\n"
+            "    {\n"
+            "        SDB_AddChars(out, \"null\", 4);\n"
+            "        return;\n"
+            "    }\n"
+            "\n"
+            "    endPtr = val + strlen(val);\n"
+            "    SDB_AddChar(out, '\"');\n"
+            "\n"
+            "    while (val < endPtr)\n"
+            "    {\n"
+            "        // Copy plain characters as a whole run, escape the rest\n"
+            "        const char *runEnd = SCAN_StringRun(val, endPtr);\n"
+            "\n"
+            "        SDB_AddChars(out, val, (size_t)(runEnd - val));\n"
+            "        if (runEnd >= endPtr) break;\n"
+            "\n"
+            "        if ((*runEnd == '\"') || (*runEnd == '\\\\'))\n"
+            "        {\n"
+            "            SDB_AddChar(out, '\\\\');\n"
+            "            SDB_AddChar(out, *runEnd);\n"
+            "        }\n"
+            "        else\n"
+            "        {\n"
+            "            char escape[8];\n"
+            "            snprintf(escape, sizeof(escape), \"\\\\u%%04x\", (unsigned char)*runEnd);\n"
+            "            SDB_AddChars(out, escape, 6);\n"
+            "        }\n"
+            "\n"
+            "        val = runEnd + 1;\n"
+            "    }\n"
+            "\n"
+            "    SDB_AddChar(out, '\"');\n"
+            "}\n", rootName, rootName, rootName);
+    }
+
+    fprintf(fPtr, "\n");
+}
+
+static void CG_EmitListFunctions(FILE *fPtr, const CG_Type_t *type, const CG_Field_t *field)
+{
+    char listType[512];
+    snprintf(listType, sizeof(listType), "%s_%s_list_t", type->name, field->member);
+
+    // Clear
+    fprintf(fPtr, "static void %s_%s_clearList(%s *list)\n{\n", type->name, field->member, listType);
+    if (field->kind == CG_String)       fprintf(fPtr, "    for (cJSON_object_size_size_t i = 0; i < list->length; i++) free(list->data[i]);\n");
+    else if (field->kind == CG_Object)  fprintf(fPtr, "    for (cJSON_object_size_size_t i = 0; i < list->length; i++) %s_freeObject(&list->data[i]);\n", field->objType->name);
+    fprintf(fPtr, "    free(list->data);\n\n    list->data = NULL;\n    list->length = 0;\n    list->capacity = 0;\n}\n");
+
+    // Parse
+    fprintf(fPtr, "static cJSON_Result_t %s_%s_parseList(%s_State_t *state, %s *list, size_t depth)\n{\n", type->name, field->member, rootName, listType);
+    fprintf(fPtr,
+        "    const char *endPtr = state->endPtr;\n"
+        "    cJSON_Result_t result;\n"
+        "\n"
+        "    if ((state->str >= endPtr) || (*state->str != '[')) return cJSON_Datatype_Error;\n"
+        "    if (depth >= CJSON_MAX_DEPTH) return cJSON_DepthOutOfRange_Error;\n"
+        "\n"
+        "    // Replace items of a duplicate key\n"
+        "    %s_%s_clearList(list);\n"
+        "\n"
+        "    state->str = SCAN_SkipWhitespace(state->str + 1, endPtr);\n"
+        "    if ((state->str < endPtr) && (*state->str == ']'))\n"
+        "    {\n"
+        "        state->str++;\n"
+        "        return cJSON_Ok;\n"
+        "    }\n"
+        "\n"
+        "    while (true)\n"
+        "    {\n"
+        "        if (list->length >= list->capacity)\n"
+        "        {\n"
+        "            list->capacity = (list->capacity > 0) ? (2 * list->capacity) : CJSON_CONTAINER_INIT_CAPACITY;\n"
+        "            list->data = realloc(list->data, list->capacity * sizeof(*list->data));\n"
+        "        }\n"
+        "        memset(&list->data[list->length], 0, sizeof(*list->data));\n"
+        "\n"
+        "        result = ", type->name, field->member);
+    CG_WriteParseCall(fPtr, field, "list->data[list->length]", "depth + 1");
+    fprintf(fPtr, ";\n");
+    fprintf(fPtr,
+        "        if (result != cJSON_Ok) return result;\n"
+        "        list->length++;\n"
+        "\n"
+        "        // Item separator or end of list\n"
+        "        state->str = SCAN_SkipWhitespace(state->str, endPtr);\n"
+        "        if (state->str >= endPtr) return cJSON_Structure_Error;\n"
+        "\n"
+        "        if (*state->str == ']')\n"
+        "        {\n"
+        "            state->str++;\n"
+        "            return cJSON_Ok;\n"
+        "        }\n"
+        "        if (*state->str != ',') return cJSON_Structure_Error;\n"
+        "\n"
+        "        state->str = SCAN_SkipWhitespace(state->str + 1, endPtr);\n"
+        "    }\n"
+        "}\n");
+
+    // Serialize
+    fprintf(fPtr, "static void %s_%s_serializeList(const %s *list, cJSON_SDB_t *out)\n{\n", type->name, field->member, listType);
+    fprintf(fPtr, "    SDB_AddChar(out, '[');\n\n    for (cJSON_object_size_size_t i = 0; i < list->length; i++)\n    {\n");
+    fprintf(fPtr, "        if (i > 0) SDB_AddChar(out, ',');\n        ");
+    CG_WriteSerializeCall(fPtr, field, "list->data[i]");
+    fprintf(fPtr, ";\n    }\n\n    SDB_AddChar(out, ']');\n}\n");
+}
+
+static void CG_EmitTypeFunctions(FILE *fPtr, const CG_Type_t *type)
+{
+    bool hasFields = false;
+
+    fprintf(fPtr, "// - %s Functions -\n#pragma region %s Functions\n\n", type->name, type->name);
+
+    for (size_t i = 0; i < type->fieldCount; i++)
+    {
+        if (type->fields[i].kind != CG_Skip) hasFields = true;
+        if (type->fields[i].isList && (type->fields[i].kind != CG_Skip)) CG_EmitListFunctions(fPtr, type, &type->fields[i]);
+    }
+
+    // Free
+    fprintf(fPtr, "static void %s_freeObject(%s_t *obj)\n{\n", type->name, type->name);
+
+    bool freesMembers = false;
+    for (size_t i = 0; i < type->fieldCount; i++)
+    {
+        const CG_Field_t *field = &type->fields[i];
+
+        if (field->kind == CG_Skip) continue;
+
+        if (field->isList)                  fprintf(fPtr, "    %s_%s_clearList(&obj->%s);\n", type->name, field->member, field->member);
+        else if (field->kind == CG_String)  fprintf(fPtr, "    free(obj->%s);\n    obj->%s = NULL;\n", field->member, field->member);
+        else if (field->kind == CG_Object)  fprintf(fPtr, "    %s_freeObject(&obj->%s);\n", field->objType->name, field->member);
+        else                                continue;
+
+        freesMembers = true;
+    }
+    if (!freesMembers) fprintf(fPtr, "    (void)obj;\n");
+    fprintf(fPtr, "}\n");
+
+    // Parse
+    fprintf(fPtr, "static cJSON_Result_t %s_parseObject(%s_State_t *state, %s_t *obj, size_t depth)\n{\n", type->name, rootName, type->name);
+    if (!hasFields) fprintf(fPtr, "    (void)obj;\n");
+    fprintf(fPtr,
+        "    const char *endPtr = state->endPtr;\n"
+        "    cJSON_Result_t result;\n"
+        "\n"
+        "    if ((state->str >= endPtr) || (*state->str != '{')) return cJSON_Datatype_Error;\n"
+        "    if (depth >= CJSON_MAX_DEPTH) return cJSON_DepthOutOfRange_Error;\n"
+        "\n"
+        "    state->str = SCAN_SkipWhitespace(state->str + 1, endPtr);\n"
+        "    if ((state->str < endPtr) && (*state->str == '}'))\n"
+        "    {\n"
+        "        state->str++;\n"
+        "        return cJSON_Ok;\n"
+        "    }\n"
+        "\n"
+        "    while (true)\n"
+        "    {\n"
+        "        int fieldId = -1;\n"
+        "\n"
+        "        // Key\n"
+        "        if ((state->str >= endPtr) || (*state->str != '\"')) return cJSON_Structure_Error;\n"
+        "\n"
+        "        result = cJSON_Parser_StringBuilder(&state->str, endPtr, &state->strBuffer);\n"
+        "        if (result != cJSON_Ok) return result;\n"
+        "\n");
+
+    if (hasFields)
+    {
+        fprintf(fPtr,
+            "        const char *key = SDB_GetStr(&state->strBuffer);\n"
+            "\n"
+            "        // Key dispatch on length, then contents\n"
+            "        switch (state->strBuffer.bufferSize)\n"
+            "        {\n");
+
+        // Group fields by key length
+        bool *emitted = (bool*)calloc(type->fieldCount + 1, sizeof(bool));
+
+        for (size_t i = 0; i < type->fieldCount; i++)
+        {
+            if (emitted[i] || (type->fields[i].kind == CG_Skip)) continue;
+
+            size_t keyLen = type->fields[i].keyLen;
+            bool isFirst = true;
+
+            fprintf(fPtr, "        case %zu:\n", keyLen);
+
+            for (size_t j = i; j < type->fieldCount; j++)
+            {
+                if (emitted[j] || (type->fields[j].kind == CG_Skip) || (type->fields[j].keyLen != keyLen)) continue;
+
+                fprintf(fPtr, "            %sif (!memcmp(key, ", isFirst ? "" : "else ");
+                CG_WriteCString(fPtr, type->fields[j].key, keyLen);
+                fprintf(fPtr, ", %zu)) fieldId = %zu;\n", keyLen, j);
+
+                emitted[j] = true;
+                isFirst = false;
+            }
+
+            fprintf(fPtr, "            break;\n");
+        }
+
+        free(emitted);
+
+        fprintf(fPtr, "        default:\n            break;\n        }\n\n");
+    }
+
+    fprintf(fPtr,
+        "        // Key-value separator\n"
+        "        state->str = SCAN_SkipWhitespace(state->str + 1, endPtr);\n"
+        "        if ((state->str >= endPtr) || (*state->str != ':')) return cJSON_Structure_Error;\n"
+        "        state->str = SCAN_SkipWhitespace(state->str + 1, endPtr);\n"
+        "\n"
+        "        // Value, null leaves the member untouched\n"
+        "        if (cJSON_Parser_MatchLiteral(state->str, endPtr, \"null\", 4))\n"
+        "        {\n"
+        "            state->str += 4;\n"
+        "        }\n"
+        "        else\n"
+        "        {\n"
+        "            switch (fieldId)\n"
+        "            {\n");
+
+    for (size_t i = 0; i < type->fieldCount; i++)
+    {
+        const CG_Field_t *field = &type->fields[i];
+        char target[512];
+
+        if (field->kind == CG_Skip) continue;
+
+        fprintf(fPtr, "            case %zu:\n                result = ", i);
+
+        if (field->isList)
+        {
+            fprintf(fPtr, "%s_%s_parseList(state, &obj->%s, depth + 1)", type->name, field->member, field->member);
+        }
+        else
+        {
+            snprintf(target, sizeof(target), "obj->%s", field->member);
+            CG_WriteParseCall(fPtr, field, target, "depth + 1");
+        }
+
+        fprintf(fPtr, ";\n                break;\n");
+    }
+
+    fprintf(fPtr,
+        "            default:\n"
+        "                // Unknown key, skip its value\n"
+        "                result = cJSON_Parser_SkipValue(&state->str, endPtr, depth + 1);\n"
+        "                state->str++;\n"
+        "                break;\n"
+        "            }\n"
+        "\n"
+        "            if (result != cJSON_Ok) return result;\n"
+        "        }\n"
+        "\n"
+        "        // Item separator or end of dictionary\n"
+        "        state->str = SCAN_SkipWhitespace(state->str, endPtr);\n"
+        "        if (state->str >= endPtr) return cJSON_Structure_Error;\n"
+        "\n"
+        "        if (*state->str == '}')\n"
+        "        {\n"
+        "            state->str++;\n"
+        "            return cJSON_Ok;\n"
+        "        }\n"
+        "        if (*state->str != ',') return cJSON_Structure_Error;\n"
+        "\n"
+        "        state->str = SCAN_SkipWhitespace(state->str + 1, endPtr);\n"
+        "    }\n"
+        "}\n");
+
+    // Serialize
+    fprintf(fPtr, "static void %s_serializeObject(const %s_t *obj, cJSON_SDB_t *out)\n{\n", type->name, type->name);
+    if (!hasFields) fprintf(fPtr, "    (void)obj;\n");
+    fprintf(fPtr, "    SDB_AddChar(out, '{');\n");
+
+    bool isFirst = true;
+    for (size_t i = 0; i < type->fieldCount; i++)
+    {
+        const CG_Field_t *field = &type->fields[i];
+        char source[512];
+
+        if (field->kind == CG_Skip) continue;
+
+        fprintf(fPtr, "    SDB_AddChars(out, ");
+        CG_WriteKeyLiteral(fPtr, field->key, field->keyLen, !isFirst);
+        fprintf(fPtr, ");\n    ");
+
+        if (field->isList)
+        {
+            fprintf(fPtr, "%s_%s_serializeList(&obj->%s, out)", type->name, field->member, field->member);
+        }
+        else
+        {
+            snprintf(source, sizeof(source), "obj->%s", field->member);
+            CG_WriteSerializeCall(fPtr, field, source);
+        }
+
+        fprintf(fPtr, ";\n");
+        isFirst = false;
+    }
+
+    fprintf(fPtr, "    SDB_AddChar(out, '}');\n}\n\n#pragma endregion\n\n");
+}
+
+static void CG_EmitSource(FILE *fPtr, const char *fileName, const char *headerName)
+{
+    fprintf(fPtr, "/**\n * @file %s\n * @brief Generated by cJSON_CodeGen, do not edit. Dedicated parser and serializer for %s_t.\n *\n */\n\n", fileName, rootName);
+    fprintf(fPtr, "#include <errno.h>\n#include <stdio.h>\n#include <stdlib.h>\n#include <string.h>\n\n");
+    fprintf(fPtr, "#include \"%s\"\n#include \"cJSON_Parser_Util.h\"\n#include \"cJSON_Scanner.h\"\n\n", headerName);
+
+    CG_EmitHelpers(fPtr);
+
+    for (CG_Type_t *type = typeListHead; type != NULL; type = type->next) CG_EmitTypeFunctions(fPtr, type);
+
+    fprintf(fPtr, "//   ---   Function Implementations   ---\n\n");
+    fprintf(fPtr,
+        "cJSON_Result_t %s_parse(%s_t *obj, const char *ptr, size_t len)\n"
+        "{\n"
+        "    %s_State_t state = {0};\n"
+        "    cJSON_Result_t result;\n"
+        "\n"
+        "    state.endPtr = ptr + len;\n"
+        "    state.str = SCAN_SkipWhitespace(ptr, state.endPtr);\n"
+        "\n"
+        "    // Root structure, only whitespace may precede and follow it\n"
+        "    if ((state.str < state.endPtr) && (*state.str == '{'))  result = %s_parseObject(&state, obj, 0);\n"
+        "    else                                                    result = cJSON_Structure_Error;\n"
+        "\n"
+        "    if ((result == cJSON_Ok) && (SCAN_SkipWhitespace(state.str, state.endPtr) != state.endPtr)) result = cJSON_Structure_Error;\n"
+        "\n"
+        "    SDB_Free(&state.strBuffer);\n"
+        "\n"
+        "    return result;\n"
+        "}\n"
+        "void %s_serialize(const %s_t *obj, cJSON_SDB_t *out)\n"
+        "{\n"
+        "    %s_serializeObject(obj, out);\n"
+        "}\n"
+        "void %s_free(%s_t *obj)\n"
+        "{\n"
+        "    %s_freeObject(obj);\n"
+        "}\n",
+        rootName, rootName, rootName, rootName, rootName, rootName, rootName, rootName, rootName, rootName);
+}
+
+#pragma endregion
+
+// - File Helper Functions -
+#pragma region File Helper Functions
+
+static char* CG_ReadFile(const char *fileName)
+{
+    FILE *fPtr = fopen(fileName, "rb");
+    if (!fPtr) return NULL;
+
+    fseek(fPtr, 0, SEEK_END);
+    long fileSize = ftell(fPtr);
+    rewind(fPtr);
+
+    char *buffer = (char*)malloc((size_t)fileSize + 1);
+    size_t bytesRead = fread(buffer, 1, (size_t)fileSize, fPtr);
+    buffer[bytesRead] = '\0';
+
+    fclose(fPtr);
+    return buffer;
+}
+
+#pragma endregion
+
+//   ---   Main   ---
+
+int main(int argc, char **argv)
+{
+    bool isSchema = (argc > 1) && !strcmp(argv[1], "--schema");
+    int argOffset = isSchema ? 2 : 1;
+
+    if (argc - argOffset != 3)
+    {
+        fprintf(stderr, "Usage: %s [--schema] <input.json> <TypeName> <outBase>\n", argv[0]);
+        return 1;
+    }
+
+    const char *inputName = argv[argOffset];
+    const char *outBase = argv[argOffset + 2];
+    char *rootIdent = CG_Identifier(argv[argOffset + 1], strlen(argv[argOffset + 1]));
+    rootName = rootIdent;
+
+    char *inputStr = CG_ReadFile(inputName);
+    if (inputStr == NULL)
+    {
+        perror("Failed to read input");
+        return 1;
+    }
+
+    cJSON_Generic_t input = {0};
+    cJSON_Result_t result = cJSON_parseStr(&input, inputStr);
+    if ((result != cJSON_Ok) || (input.type != Dictionary))
+    {
+        fprintf(stderr, "Input is not a JSON dictionary (error code %d)\n", (int)result);
+        return 1;
+    }
+
+    if (isSchema)
+    {
+        CG_TypeFromSchema(AS_DICT_PTR(input), rootName);
+    }
+    else
+    {
+        CG_CheckIntRange(inputStr, inputStr + strlen(inputStr));
+        CG_TypeFromExample(AS_DICT_PTR(input), rootName);
+    }
+
+    // Output file names, the header is included by its base name
+    char *headerPath = CG_Concat(outBase, ".h", "");
+    char *sourcePath = CG_Concat(outBase, ".c", "");
+    const char *headerName = strrchr(headerPath, '/') ? (strrchr(headerPath, '/') + 1) : headerPath;
+    const char *sourceName = strrchr(sourcePath, '/') ? (strrchr(sourcePath, '/') + 1) : sourcePath;
+
+    char *guardName = CG_Concat(rootName, "_GENERATED_DEFINED", "");
+    for (char *c = guardName; *c; c++) *c = (char)toupper((unsigned char)*c);
+
+    FILE *headerFile = fopen(headerPath, "w");
+    FILE *sourceFile = fopen(sourcePath, "w");
+    if ((headerFile == NULL) || (sourceFile == NULL))
+    {
+        perror("Failed to open output");
+        return 1;
+    }
+
+    CG_EmitHeader(headerFile, headerName, guardName);
+    CG_EmitSource(sourceFile, sourceName, headerName);
+
+    fclose(headerFile);
+    fclose(sourceFile);
+
+    cJSON_delGenObj(input);
+    free(inputStr);
+    free(headerPath);
+    free(sourcePath);
+    free(guardName);
+
+    return 0;
+}